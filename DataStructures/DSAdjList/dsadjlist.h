@@ -2,12 +2,74 @@
 #define DSADJLIST_H
 
 #include "../DSDoublyLL/dsdoublyll.h"
+#include "../DSHashMap/dshashmap.h"
 
-template <class T>
+/**
+ * @brief The DSNoWeight struct - edge weight for graphs whose edges carry no data
+ */
+struct DSNoWeight{
+    bool operator==(const DSNoWeight&) const{
+        return true;
+    }
+
+    bool operator!=(const DSNoWeight&) const{
+        return false;
+    }
+};
+
+/**
+ * @brief The DSAdjList class - directed multigraph, every edge is stored in its source's list with a weight
+ */
+template <class T, class W = DSNoWeight, class Hash = DSHash<T>>
 class DSAdjList
 {
+public:
+    /**
+     * @brief The Edge struct - an outgoing edge and its weight
+     */
+    struct Edge{
+        T dest;
+        W weight;
+
+        bool operator==(const Edge& other) const{
+            return dest == other.dest && weight == other.weight;
+        }
+
+        bool operator!=(const Edge& other) const{
+            return !(*this == other);
+        }
+    };
+
 private:
-    DSDoublyLL<DSDoublyLL<T>> data;
+    /**
+     * @brief The Vertex struct - a node and the edges leaving it
+     */
+    struct Vertex{
+        T node;
+        DSDoublyLL<Edge> edges;
+    };
+
+    // every vertex's edge list allocates from this pool, declared first so it outlives the lists
+    DSNodePool<Edge> edgePool;
+
+    DSDoublyLL<Vertex> data;
+
+    // vertex of every node, the vertices stay put in data while the index moves
+    DSHashMap<T, Vertex*, Hash> index;
+
+    /**
+     * @brief findVertex - returns the vertex of the given node
+     * @param nodeData - node to find
+     * @return pointer to the vertex, nullptr if the node is not in the list
+     */
+    Vertex* findVertex(const T& nodeData) const;
+
+    /**
+     * @brief addVertex - returns the vertex of the given node, creating it if needed
+     * @param nodeData - node to find or add
+     * @return pointer to the vertex
+     */
+    Vertex* addVertex(const T& nodeData);
 public:
     /**
      * @brief DSAdjList - default constructor
@@ -18,68 +80,76 @@ public:
      * @brief DSAdjList - copy constructor
      * @param other - list to copy
      */
-    DSAdjList(DSAdjList<T>& other);
+    DSAdjList(const DSAdjList<T, W, Hash>& other);
 
     /**
-     * @brief GetConnectedNode - returns all nodes connected to the given node
+     * @brief GetConnectedNode - returns all nodes the given node has an edge to
      * @param nodeData - data of the source node for connections
-     * @return doubly linked list of nodes
+     * @return doubly linked list of nodes, with one entry per edge
+     */
+    DSDoublyLL<T> GetConnectedNodes(const T& nodeData) const;
+
+    /**
+     * @brief getEdges - returns the edges leaving the given node without copying them
+     * @param nodeData - data of the source node
+     * @return pointer to the node's edge list, nullptr if the node is not in the list
      */
-    DSDoublyLL<T> GetConnectedNodes(T nodeData);
+    DSDoublyLL<Edge>* getEdges(const T& nodeData) const;
 
     /**
      * @brief addNode - adds a new node to the list
      * @param nodeData - the value of the new node
      */
-    void addNode(T nodeData);
+    void addNode(const T& nodeData);
 
     /**
-     * @brief addEdge - adds a connection between two nodes and adding the nodes if needed
-     * @param node1 - first node of the edge
-     * @param node2 - second node of the edge
+     * @brief addEdge - adds a directed edge between two nodes, adding the nodes if needed
+     * @param node1 - source node of the edge
+     * @param node2 - destination node of the edge
+     * @param weight - weight of the edge
      */
-    void addEdge(T node1, T node2);
+    void addEdge(const T& node1, const T& node2, const W& weight = W());
 
     /**
      * @brief remove - removes a node and all of its edges
      * @param nodeData - the value of the node
      */
-    void removeNode(T nodeData);
+    void removeNode(const T& nodeData);
 
     /**
-     * @brief removeEdge - removes an edge from the list
-     * @param node1 - first node of the edge
-     * @param node2 - second node of the edge
+     * @brief removeEdge - removes every edge from one node to another
+     * @param node1 - source node of the edge
+     * @param node2 - destination node of the edge
      */
-    void removeEdge(T node1, T node2);
+    void removeEdge(const T& node1, const T& node2);
 
     /**
      * @brief contains - returns true if the given node is in the list
      * @param node - node to search for
      * @return true if node is in the list
      */
-    bool contains(T node);
+    bool contains(const T& node) const;
 
     /**
      * @brief operator = :  sets this list equal to the list passed in
      * @param other - reference to target list
      * @return returns this
      */
-    DSAdjList<T>& operator=(const DSAdjList<T>& other);
+    DSAdjList<T, W, Hash>& operator=(const DSAdjList<T, W, Hash>& other);
 
     /**
      * @brief operator == :  compares this list against another list
      * @param other - reference to target list
      * @return true if the lists have equal values
      */
-    bool operator==(const DSAdjList<T>& other) const;
+    bool operator==(const DSAdjList<T, W, Hash>& other) const;
 
     /**
      * @brief operator != : compares this list against another list
      * @param other - reference to target list
      * @return false if the lists have equal values
      */
-    bool operator!=(const DSAdjList<T>& other) const;
+    bool operator!=(const DSAdjList<T, W, Hash>& other) const;
 
     /**
      * @brief ~DSAdList - default destructor
@@ -91,180 +161,187 @@ public:
 /**
  * @brief DSAdjList - default constructor
  */
-template <class T>
-DSAdjList<T>::DSAdjList(){}
+template <class T, class W, class Hash>
+DSAdjList<T, W, Hash>::DSAdjList(){}
 
 /**
  * @brief DSAdjList - copy constructor
  * @param other - list to copy
  */
-template <class T>
-DSAdjList<T>::DSAdjList(DSAdjList<T>& other){
-    data = other.data;
+template <class T, class W, class Hash>
+DSAdjList<T, W, Hash>::DSAdjList(const DSAdjList<T, W, Hash>& other){
+    *this = other;
 }
 
 /**
- * @brief GetConnectedNode - returns all linked list that is the tail of the given element's list
+ * @brief GetConnectedNode - copies the destination of every edge leaving the given node
  * @param nodeData - data of the source node for connections
- * @return doubly linked list of nodes
+ * @return doubly linked list of nodes, with one entry per edge
  */
-template <class T>
-DSDoublyLL<T> DSAdjList<T>::GetConnectedNodes(T nodeData){
-    for(auto list : data){
-        if(list[0] == nodeData){
-            DSDoublyLL<T> output = list;
-            output.removeAt(0);
-            return output;
-        }
+template <class T, class W, class Hash>
+DSDoublyLL<T> DSAdjList<T, W, Hash>::GetConnectedNodes(const T& nodeData) const{
+    DSDoublyLL<T> output;
+    Vertex* vertex = findVertex(nodeData);
+
+    if(vertex == nullptr){
+        return output;
+    }
+
+    for(auto& edge : vertex->edges){
+        output.pushBack(edge.dest);
     }
 
-    return DSDoublyLL<T>();
+    return output;
 }
 
 /**
- * @brief addNode - creates a new list at the end of the data list for the given node
- * @param nodeData - the value of the new node
+ * @brief getEdges - looks up the node and returns its edge list
+ * @param nodeData - data of the source node
+ * @return pointer to the node's edge list, nullptr if the node is not in the list
  */
-template <class T>
-void DSAdjList<T>::addNode(T nodeData){
-    if(contains(nodeData)){
-        return;
+template <class T, class W, class Hash>
+DSDoublyLL<typename DSAdjList<T, W, Hash>::Edge>* DSAdjList<T, W, Hash>::getEdges(const T& nodeData) const{
+    Vertex* vertex = findVertex(nodeData);
+
+    if(vertex == nullptr){
+        return nullptr;
     }
 
-    DSDoublyLL<T> newNode;
-    newNode.pushBack(nodeData);
-    data.pushBack(newNode);
+    return &vertex->edges;
 }
 
 /**
- * @brief addEdge - adds the given nodes to eachother's lists
- * @param node1 - first node of the edge
- * @param node2 - second node of the edge
+ * @brief addNode - creates a new vertex at the end of the data list for the given node and indexes it
+ * @param nodeData - the value of the new node
  */
-template <class T>
-void DSAdjList<T>::addEdge(T node1, T node2){
-    bool node1Found = false;
-    bool node2Found = false;
-
-    for(auto i = data.begin(); i != data.end() && (!node2Found || !node1Found); i++){
-        if((*i)[0] == node1){
-            if(i->contains(node2)){
-                return;
-            }
-            i->pushBack(node2);
-            node1Found = true;
-        } else if((*i)[0] == node2){
-            if(i->contains(node1)){
-                return;
-            }
-            i->pushBack(node1);
-            node2Found = true;
-        }
-    }
-
-    if(!node1Found){
-        addNode(node1);
-        data[data.size() - 1].pushBack(node2);
-    }
+template <class T, class W, class Hash>
+void DSAdjList<T, W, Hash>::addNode(const T& nodeData){
+    addVertex(nodeData);
+}
 
-    if(!node2Found){
-        addNode(node2);
-        data[data.size() - 1].pushBack(node1);
-    }
+/**
+ * @brief addEdge - appends the edge to the source's list, parallel edges are kept
+ * @param node1 - source node of the edge
+ * @param node2 - destination node of the edge
+ * @param weight - weight of the edge
+ */
+template <class T, class W, class Hash>
+void DSAdjList<T, W, Hash>::addEdge(const T& node1, const T& node2, const W& weight){
+    Vertex* source = addVertex(node1);
+    addVertex(node2);
+
+    Edge edge;
+    edge.dest = node2;
+    edge.weight = weight;
+    source->edges.pushBack(edge);
 }
 
 /**
- * @brief remove - removes a node's list and all of its occurances in other lists
+ * @brief remove - removes a node's vertex, its index entry and every edge pointing to it
  * @param nodeData - the value of the node
  */
-template <class T>
-void DSAdjList<T>::removeNode(const T nodeData){
+template <class T, class W, class Hash>
+void DSAdjList<T, W, Hash>::removeNode(const T& nodeData){
+    if(!index.erase(nodeData)){
+        return;
+    }
+
     for(auto i = data.begin(); i != data.end();){
-        if((*i)[0] == nodeData){
+        if(i->node == nodeData){
             i = data.removeAt(i);
-        } else {
-            i->remove(nodeData, true);
-            i++;
+            continue;
         }
+
+        for(auto j = i->edges.begin(); j != i->edges.end();){
+            if(j->dest == nodeData){
+                j = i->edges.removeAt(j);
+            } else {
+                j++;
+            }
+        }
+        i++;
     }
 }
 
 /**
- * @brief removeEdge - removes the given nodes from each others lists
- * @param node1 - first node of the edge
- * @param node2 - second node of the edge
+ * @brief removeEdge - removes every edge from node1 to node2 from node1's list
+ * @param node1 - source node of the edge
+ * @param node2 - destination node of the edge
  */
-template <class T>
-void DSAdjList<T>::removeEdge(const T node1, const T node2){
-    for(auto& list : data){
-        if(list[0] == node1){
-            list.remove(node2, true);
-        } else if(list[0] == node2){
-            list.remove(node1, true);
+template <class T, class W, class Hash>
+void DSAdjList<T, W, Hash>::removeEdge(const T& node1, const T& node2){
+    Vertex* source = findVertex(node1);
+
+    if(source == nullptr){
+        return;
+    }
+
+    for(auto i = source->edges.begin(); i != source->edges.end();){
+        if(i->dest == node2){
+            i = source->edges.removeAt(i);
+        } else {
+            i++;
         }
     }
 }
 
 /**
- * @brief contains - iterates through data and returns true if node is the head of any list
+ * @brief contains - looks the node up in the vertex index
  * @param query - nade to search for in data
  * @return true if node is in data
  */
-template<class T>
-bool DSAdjList<T>::contains(T query)
+template <class T, class W, class Hash>
+bool DSAdjList<T, W, Hash>::contains(const T& query) const
 {
-    for(auto list : data){
-        if(list[0] == query){
-            return true;
-        }
-    }
-
-    return false;
+    return findVertex(query) != nullptr;
 }
 
 /**
- * @brief operator = :  sets this list equal to the list passed in
+ * @brief operator = :  rebuilds this list from the list passed in, so the copied edges come from this list's pool
  * @param other - reference to target list
  * @return returns this
  */
-template <class T>
-DSAdjList<T>& DSAdjList<T>::operator=(const DSAdjList<T>& other){
-    data = other.data;
+template <class T, class W, class Hash>
+DSAdjList<T, W, Hash>& DSAdjList<T, W, Hash>::operator=(const DSAdjList<T, W, Hash>& other){
+    if(this == &other){
+        return *this;
+    }
+
+    data.clear();
+    index.clear();
+    index.reserve(other.index.size());
+
+    for(const auto& entry : other.index){
+        addVertex(entry.key);
+    }
+
+    for(const auto& entry : other.index){
+        Vertex* vertex = findVertex(entry.key);
+        for(auto& edge : entry.value->edges){
+            vertex->edges.pushBack(edge);
+        }
+    }
+
+    return *this;
 }
 
 /**
- * @brief operator == :  compares this list against another list by checking for the same nodes and connections
+ * @brief operator == :  compares this list against another list by checking for the same nodes and edges
  * @param other - reference to target list
- * @return true if the list contains the same connections
+ * @return true if the list contains the same edges, in any order
  */
-template <class T>
-bool DSAdjList<T>::operator==(const DSAdjList<T>& other) const{
+template <class T, class W, class Hash>
+bool DSAdjList<T, W, Hash>::operator==(const DSAdjList<T, W, Hash>& other) const{
     if(data.size() != other.data.size()){
         return false;
     }
 
-    if(data.size() == 0){
-        return true;
-    }
-
-    DSDoublyLL<DSDoublyLL<T>> tempData = data;
-    DSDoublyLL<DSDoublyLL<T>> tempOther = other.data;
-
-    for (auto i = tempData.begin(); i != tempData.end(); i++) {
-        auto match = tempOther.end();
-
-        for (auto j = tempOther.begin(); j != tempOther.end(); j++){
-            if (i->unorderedEquals(*j)) {
-                match = j;
-                break;
-            }
-        }
-
-        if (match == tempOther.end()) {
+    for(const auto& entry : index){
+        Vertex* vertex = entry.value;
+        Vertex* match = other.findVertex(vertex->node);
+        if(match == nullptr || !vertex->edges.unorderedEquals(match->edges)){
             return false;
         }
-
-        tempOther.removeAt(match);
     }
 
     return true;
@@ -275,15 +352,48 @@ bool DSAdjList<T>::operator==(const DSAdjList<T>& other) const{
  * @param other - reference to target list
  * @return opposite of operator==
  */
-template <class T>
-bool DSAdjList<T>::operator!=(const DSAdjList<T>& other) const{
+template <class T, class W, class Hash>
+bool DSAdjList<T, W, Hash>::operator!=(const DSAdjList<T, W, Hash>& other) const{
     return !(*this == other);
 }
 
 /**
  * @brief ~DSAdList - default destructor
  */
-template <class T>
-DSAdjList<T>::~DSAdjList(){}
+template <class T, class W, class Hash>
+DSAdjList<T, W, Hash>::~DSAdjList(){}
+
+/**
+ * @brief findVertex - looks the node up in the vertex index
+ * @param nodeData - node to find
+ * @return pointer to the vertex, nullptr if the node is not in the list
+ */
+template <class T, class W, class Hash>
+typename DSAdjList<T, W, Hash>::Vertex* DSAdjList<T, W, Hash>::findVertex(const T& nodeData) const{
+    Vertex* const* vertex = index.find(nodeData);
+
+    return vertex == nullptr ? nullptr : *vertex;
+}
+
+/**
+ * @brief addVertex - looks the node up and appends a new vertex for it if it is missing
+ * @param nodeData - node to find or add
+ * @return pointer to the vertex
+ */
+template <class T, class W, class Hash>
+typename DSAdjList<T, W, Hash>::Vertex* DSAdjList<T, W, Hash>::addVertex(const T& nodeData){
+    Vertex* vertex = findVertex(nodeData);
+    if(vertex != nullptr){
+        return vertex;
+    }
+
+    Vertex newVertex = {nodeData, DSDoublyLL<Edge>(edgePool)};
+    data.pushBack(newVertex);
+
+    vertex = &data[data.size() - 1];
+    index.insert(nodeData, vertex);
+
+    return vertex;
+}
 
 #endif // DSADJLIST_H
@@ -1,8 +1,21 @@
 #ifndef DSDOUBLYLL_H
 #define DSDOUBLYLL_H
 
+#include <cstdlib>
+
 #include "dsnode.h"
+#include "dsnodepool.h"
 
+/**
+ * @brief The DSDoublyLL class - doubly linked list whose nodes come from a DSNodePool
+ *
+ * By default every list owns a pool, so its nodes are allocated in chunks and released together by clear and the
+ * destructor. Lists given a shared pool return their nodes to it one at a time, and copies of them share it too.
+ *
+ * Indexing walks from the head, the tail or the node returned by the last index, whichever is closest, so loops
+ * over consecutive indices cost O(1) per step. Since operator[] moves that cursor, concurrent readers of one list
+ * must be synchronised.
+ */
 template <class T>
 class DSDoublyLL{
     private:
@@ -101,6 +114,12 @@ class DSDoublyLL{
          */
         DSDoublyLL();
 
+        /**
+         * @brief DSDoublyLL - constructor, allocates nodes from a pool shared with other lists
+         * @param sharedPool - pool to allocate from, must outlive the list
+         */
+        explicit DSDoublyLL(DSNodePool<T>& sharedPool);
+
         /**
          * @brief DSDoublyLL - constructor
          * @param data - pointer to array of size elements
@@ -262,6 +281,26 @@ class DSDoublyLL{
 
         int numIndexes = 0;
 
+        // node returned by the last getNodeAt and its index, nullptr when unknown
+        mutable DSNode<T>* cursor = nullptr;
+        mutable int cursorIndex = 0;
+
+        // pool the nodes come from, ownPool unless the list was given a shared pool
+        DSNodePool<T> ownPool;
+        DSNodePool<T>* pool = &ownPool;
+
+        /**
+         * @brief unlink - removes a node from the list and destroys it
+         * @param node - node of this list
+         * @return node that followed the removed node
+         */
+        DSNode<T>* unlink(DSNode<T>* node);
+
+        /**
+         * @brief destroyNodes - destroys every node, leaving the list's links untouched
+         */
+        void destroyNodes();
+
         /**
          * @brief getNodeAt: returns node at given index
          * @param index - index at which the node is
@@ -276,6 +315,13 @@ class DSDoublyLL{
 template <class T>
 DSDoublyLL<T>::DSDoublyLL(){}
 
+/**
+ * @brief DSDoublyLL - constructor, allocates nodes from a pool shared with other lists
+ * @param sharedPool - pool to allocate from, must outlive the list
+ */
+template <class T>
+DSDoublyLL<T>::DSDoublyLL(DSNodePool<T>& sharedPool) : pool(&sharedPool){}
+
 /**
  * @brief DSDoublyLL - constructor
  * @param data - pointer to array of size elements
@@ -289,11 +335,11 @@ DSDoublyLL<T>::DSDoublyLL(const T* data, const int size){
 }
 
 /**
- * @brief DSDoublyLL - copy constructor
+ * @brief DSDoublyLL - copy constructor, the copy shares other's pool if it is shared and has its own otherwise
  * @param other - reference to the list to copy
  */
 template <class T>
-DSDoublyLL<T>::DSDoublyLL(const DSDoublyLL& other){
+DSDoublyLL<T>::DSDoublyLL(const DSDoublyLL& other) : pool(other.pool == &other.ownPool ? &ownPool : other.pool){
     for(DSNode<T>* n = other.head; n != nullptr; n = n->next){
         pushBack(n->data);
     }
@@ -316,8 +362,8 @@ int DSDoublyLL<T>::getNumIndexes() const{
 template <class T>
 void DSDoublyLL<T>::pushFront(const T data){
     numIndexes++;
-    DSNode<T>* newNode = new DSNode<T>;
-    newNode->data = data;
+    DSNode<T>* newNode = pool->create(data);
+    cursorIndex++;
 
     if(head == nullptr){
         head = newNode;
@@ -337,8 +383,7 @@ void DSDoublyLL<T>::pushFront(const T data){
 template <class T>
 void DSDoublyLL<T>::pushBack(const T data){
     numIndexes++;
-    DSNode<T>* newNode = new DSNode<T>;
-    newNode->data = data;
+    DSNode<T>* newNode = pool->create(data);
 
     if(tail == nullptr){
         head = newNode;
@@ -369,8 +414,11 @@ void DSDoublyLL<T>::insert(int index, const T data){
     }
 
     DSNode<T>* nodeBefore = getNodeAt(index - 1);
+    if(index <= cursorIndex){
+        cursorIndex++;
+    }
 
-    DSNode<T>* newNode = new DSNode<T>(data);
+    DSNode<T>* newNode = pool->create(data);
 
     newNode->next = nodeBefore->next;
     newNode->prev = nodeBefore;
@@ -383,7 +431,8 @@ void DSDoublyLL<T>::insert(int index, const T data){
 }
 
 /**
- * @brief DSDoublyLL::remove - removes and deletes the node at an index and links the next and previous nodes together
+ * @brief DSDoublyLL::remove - removes and destroys the node at an index and links the next and previous nodes
+ * together
  * @param index - index where the node will be removed
  */
 template <class T>
@@ -392,62 +441,13 @@ void DSDoublyLL<T>::removeAt(int index){
         return;
     }
 
-    if(numIndexes == 1){
-        delete head;
-        numIndexes--;
-
-        head = nullptr;
-        tail = nullptr;
-
-        return;
-    }
-
-    if(index == 0){
-        if(head == tail){
-            delete head;
-
-            head == nullptr;
-            tail == nullptr;
-        } else{
-            DSNode<T>* temp = head->next;
-            delete head;
-
-            head = temp;
-            head->prev = nullptr;
-        }
-
-        numIndexes--;
-        return;
-    }
-
-    if(index == numIndexes - 1){
-        DSNode<T>* temp = tail->prev;
-        delete tail;
-        numIndexes--;
-
-        tail = temp;
-        tail->next = nullptr;
-
-        return;
-    }
-
-    DSNode<T>* target = getNodeAt(index);
-
-    target->prev->next = target->next;
-
-    if(target->next != nullptr){
-        target->next->prev = target->prev;
-    } else {
-        tail = target->prev;
-    }
-
-    delete target;
-    numIndexes--;
+    unlink(getNodeAt(index));
 }
 
 /**
  * @brief DSDoublyLL::removeAt - remove element at the given iterator
  * @param index - iterator pointing to the target element
+ * @return iterator to the element after the removed one
  */
 template<class T>
 typename DSDoublyLL<T>::iterator DSDoublyLL<T>::removeAt(iterator index){
@@ -455,118 +455,38 @@ typename DSDoublyLL<T>::iterator DSDoublyLL<T>::removeAt(iterator index){
         return iterator(head);
     }
 
-    if(numIndexes == 1 && head == index.ptr){
-        head = nullptr;
-        tail = nullptr;
-
-        delete index.ptr;
-        numIndexes = 0;
-
-        return iterator(head);
-    }
-
-    if(head == index.ptr){
-        head = head->next;
-        head->prev = nullptr;
-
-        delete index.ptr;
-        numIndexes--;
-
-        return iterator(head);
-    }
-
-    if(tail == index.ptr){
-        tail = tail->prev;
-        tail->next = nullptr;
-
-        delete index.ptr;
-        numIndexes--;
-
-        return iterator(nullptr);
-    }
-
-    index.ptr->prev->next = index.ptr->next;
-    index.ptr->next->prev = index.ptr->prev;
-
-    iterator output = iterator(index.ptr->next);
-
-    delete index.ptr;
-    numIndexes--;
-
-    return output;
+    return iterator(unlink(index.ptr));
 }
 
 /**
  * @brief DSDoublyLL::remove - iterates through list and removes the given element
  * @param element - element to remove
+ * @param onlyFirst - if true, only the first instance is removed
  */
 template<class T>
 void DSDoublyLL<T>::remove(const T element, bool onlyFirst)
 {
-    while(head->data == element){
-        if(head == tail){
-            delete head;
-
-            head == nullptr;
-            tail == nullptr;
-            numIndexes--;
-            return;
-        } else{
-            DSNode<T>* temp = head->next;
-            delete head;
-
-            head = temp;
-            head->prev = nullptr;
-
-            numIndexes--;
-            if(onlyFirst){
-                return;
-            }
-        }
-    }
-
-    for(DSNode<T>* current = head->next; current != tail; current = current->next){
+    DSNode<T>* current = head;
+    while(current != nullptr){
         if(current->data == element){
-            current->prev->next = current->next;
-            current->next->prev = current->prev;
-
-            DSNode<T>* temp = current;
-            current = current->prev;
-            delete temp;
+            current = unlink(current);
 
-            numIndexes--;
             if(onlyFirst){
                 return;
             }
-        }
-    }
-
-    while(tail->data == element){
-        DSNode<T>* temp = tail->prev;
-        delete tail;
-
-        tail = temp;
-        tail->next = nullptr;
-
-        numIndexes--;
-        if(onlyFirst){
-            return;
+        } else {
+            current = current->next;
         }
     }
 }
 
 /**
- * @brief clear - removes all data from list
+ * @brief clear - destroys every node, an owned pool frees all of its chunks at once
  */
 template <class T>
 void DSDoublyLL<T>::clear(){
-    DSNode<T>* next;
-    DSNode<T>* current = head;
-    while(current != nullptr){
-        next = current->next;
-        delete current;
-        current = next;
-    }
+    destroyNodes();
+    cursor = nullptr;
 
     numIndexes = 0;
     head = nullptr;
@@ -574,7 +494,7 @@ void DSDoublyLL<T>::clear(){
 }
 
 /**
- * @brief DSDoublyLL::popFront - deletes the first node and sets it to nullptr
+ * @brief DSDoublyLL::popFront - destroys the first node
  */
 template <class T>
 void DSDoublyLL<T>::popFront(){
@@ -582,29 +502,11 @@ void DSDoublyLL<T>::popFront(){
         return;
     }
 
-    numIndexes--;
-
-    if(numIndexes == 0){
-        delete head;
-        head = nullptr;
-        tail = nullptr;
-        return;
-    }
-
-    if(numIndexes == 1){
-        delete head;
-        head = tail;
-        head->prev = nullptr;
-        return;
-    }
-
-    head = head->next;
-    delete head->prev;
-    head->prev = nullptr;
+    unlink(head);
 }
 
 /**
- * @brief DSDoublyLL::popBack - deletes the last node and sets it to nullptr
+ * @brief DSDoublyLL::popBack - destroys the last node
  */
 template<class T>
 void DSDoublyLL<T>::popBack(){
@@ -612,25 +514,7 @@ void DSDoublyLL<T>::popBack(){
         return;
     }
 
-    numIndexes--;
-
-    if(numIndexes == 0){
-        delete tail;
-        head = nullptr;
-        tail = nullptr;
-        return;
-    }
-
-    if(numIndexes == 1){
-        delete tail;
-        tail = head;
-        tail->next = nullptr;
-        return;
-    }
-
-    tail = tail->prev;
-    delete tail->next;
-    tail->next = nullptr;
+    unlink(tail);
 }
 
 /**
@@ -692,13 +576,7 @@ bool DSDoublyLL<T>::unorderedEquals(const DSDoublyLL<T> &other) const
             return false;
         }
 
-        if(match == temp.head){
-            temp.head = match->next;
-        } else{
-            match->prev->next = match->next;
-        }
-
-        delete match;
+        temp.unlink(match);
     }
 
     return true;
@@ -739,17 +617,8 @@ DSDoublyLL<T>& DSDoublyLL<T>::operator=(const DSDoublyLL<T>& other){
         otherI = otherI->next;
     }
 
-    if(dataI != nullptr){
-        DSNode<T>* next;
-        tail = dataI->prev;
-        tail->next = nullptr;
-
-        while(dataI != nullptr){
-            next = dataI->next;
-            delete dataI;
-            dataI = next;
-            numIndexes--;
-        }
+    while(dataI != nullptr){
+        dataI = unlink(dataI);
     }
 
     return *this;
@@ -822,50 +691,112 @@ bool DSDoublyLL<T>::operator!=(const DSDoublyLL<T>& other) const{
 }
 
 /**
- * @brief ~DSDoublyLL - default destructor
+ * @brief ~DSDoublyLL - destroys every node, an owned pool then frees its chunks
  */
 template <class T>
 DSDoublyLL<T>::~DSDoublyLL(){
-    DSNode<T>* next;
-    DSNode<T>* current = head;
-    while(current != nullptr){
-        next = current->next;
-        delete current;
-        current = next;
-    }
+    destroyNodes();
 }
 
 /**
- * @brief getNodeAt: returns node at given index
- * @param index - index at which the node is
+ * @brief getNodeAt: walks to the index from the head, the tail or the cursor, whichever is closest, and moves the
+ * cursor to the node found
+ * @param index - index at which the node is, negative indexes count from the tail
  * @return node pointer
  */
 template <class T>
 DSNode<T>* DSDoublyLL<T>::getNodeAt(int index) const{
-    DSNode<T>* current;
     if(index < 0){
         index = numIndexes + index;
     }
-    if(index > (numIndexes / 2) - 1){
-        index = index - numIndexes;
-    }
 
+    DSNode<T>* current = head;
+    int position = 0;
 
-    if(index < 0){
+    if(numIndexes - 1 - index < index){
         current = tail;
+        position = numIndexes - 1;
+    }
 
-        for(int i = -1; i > index; i--){
-            current = current->prev;
-        }
+    if(cursor != nullptr && std::abs(index - cursorIndex) < std::abs(index - position)){
+        current = cursor;
+        position = cursorIndex;
+    }
+
+    while(position < index){
+        current = current->next;
+        position++;
+    }
+
+    while(position > index){
+        current = current->prev;
+        position--;
+    }
+
+    cursor = current;
+    cursorIndex = index;
+
+    return current;
+}
+
+/**
+ * @brief unlink - links the node's neighbours to each other, moving head or tail if needed, and destroys the node,
+ * the cursor is kept when the removed node's index is known to be before or after it
+ * @param node - node of this list
+ * @return node that followed the removed node
+ */
+template <class T>
+DSNode<T>* DSDoublyLL<T>::unlink(DSNode<T>* node){
+    DSNode<T>* next = node->next;
+
+    if(node == head && node != cursor){
+        cursorIndex--;
+    } else if(node != tail || node == cursor){
+        cursor = nullptr;
+    }
+
+    if(node->prev != nullptr){
+        node->prev->next = next;
     } else {
-        current = head;
+        head = next;
+    }
 
-        for(int i = 0; i < index; i++){
-            current = current->next;
+    if(next != nullptr){
+        next->prev = node->prev;
+    } else {
+        tail = node->prev;
+    }
+
+    pool->destroy(node);
+    numIndexes--;
+
+    return next;
+}
+
+/**
+ * @brief destroyNodes - destroys every node, an owned pool then frees its chunks in one pass instead of keeping
+ * the slots
+ */
+template <class T>
+void DSDoublyLL<T>::destroyNodes(){
+    DSNode<T>* next;
+    DSNode<T>* current = head;
+
+    if(pool != &ownPool){
+        while(current != nullptr){
+            next = current->next;
+            pool->destroy(current);
+            current = next;
         }
+        return;
     }
 
-    return current;
+    while(current != nullptr){
+        next = current->next;
+        current->~DSNode<T>();
+        current = next;
+    }
+    ownPool.releaseAll();
 }
 
 #endif // DSDOUBLYLL_H
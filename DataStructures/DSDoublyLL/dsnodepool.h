@@ -0,0 +1,148 @@
+#ifndef DSNODEPOOL_H
+#define DSNODEPOOL_H
+
+#include <new>
+
+#include "dsnode.h"
+#include "../DSVector/dsvector.h"
+
+/**
+ * @brief The DSNodePool class - hands out list nodes from contiguous chunks
+ *
+ * Nodes are carved from chunks that double in size up to MAX_CHUNK nodes, so a list built front to back sits in a
+ * few blocks of memory instead of one heap allocation per element. Destroyed nodes go on a free list and are reused
+ * before the chunks grow. A pool can be owned by one list, which releases every chunk at once when it is cleared, or
+ * shared by many lists, which then return their nodes one at a time. A shared pool must outlive every list using it.
+ */
+template <class T>
+class DSNodePool
+{
+public:
+    /**
+     * @brief DSNodePool - default constructor, allocates nothing until the first node
+     */
+    DSNodePool();
+
+    DSNodePool(const DSNodePool<T>& other) = delete;
+    DSNodePool<T>& operator=(const DSNodePool<T>& other) = delete;
+
+    /**
+     * @brief create - constructs a node holding a copy of data
+     * @param data - value of the node
+     * @return pointer to the node, its links are nullptr
+     */
+    DSNode<T>* create(const T& data);
+
+    /**
+     * @brief destroy - destroys a node created by this pool and keeps its memory for the next node
+     * @param node - node to destroy
+     */
+    void destroy(DSNode<T>* node);
+
+    /**
+     * @brief releaseAll - frees every chunk at once, the nodes must already be destroyed
+     */
+    void releaseAll();
+
+    /**
+     * @brief ~DSNodePool - destructor, frees every chunk
+     */
+    ~DSNodePool();
+
+private:
+    /**
+     * @brief The Slot struct - raw memory for one node, holding the next free slot while unused
+     */
+    struct alignas(DSNode<T>) Slot{
+        unsigned char bytes[sizeof(DSNode<T>)];
+    };
+
+    static const int FIRST_CHUNK = 16;
+    static const int MAX_CHUNK = 4096;
+
+    DSVector<Slot*> chunks;
+
+    // unused slots at the end of the newest chunk
+    Slot* next = nullptr;
+    Slot* end = nullptr;
+
+    // destroyed nodes, linked through their first bytes
+    Slot* freeList = nullptr;
+
+    int chunkSize = FIRST_CHUNK;
+};
+
+/**
+ * @brief DSNodePool - default constructor, allocates nothing until the first node
+ */
+template <class T>
+DSNodePool<T>::DSNodePool(){}
+
+/**
+ * @brief create - takes a slot from the free list, then from the newest chunk, and only allocates a chunk when
+ * both are empty
+ * @param data - value of the node
+ * @return pointer to the node, its links are nullptr
+ */
+template <class T>
+DSNode<T>* DSNodePool<T>::create(const T& data){
+    Slot* slot;
+
+    if(freeList != nullptr){
+        slot = freeList;
+        freeList = *reinterpret_cast<Slot**>(slot);
+    } else {
+        if(next == end){
+            next = static_cast<Slot*>(::operator new(sizeof(Slot) * chunkSize));
+            end = next + chunkSize;
+            chunks.pushBack(next);
+
+            if(chunkSize < MAX_CHUNK){
+                chunkSize *= 2;
+            }
+        }
+
+        slot = next++;
+    }
+
+    return new (slot) DSNode<T>(data);
+}
+
+/**
+ * @brief destroy - runs the node's destructor and pushes its slot on the free list
+ * @param node - node to destroy
+ */
+template <class T>
+void DSNodePool<T>::destroy(DSNode<T>* node){
+    node->~DSNode<T>();
+
+    Slot* slot = reinterpret_cast<Slot*>(node);
+    *reinterpret_cast<Slot**>(slot) = freeList;
+    freeList = slot;
+}
+
+/**
+ * @brief releaseAll - frees every chunk and starts the next one small again
+ */
+template <class T>
+void DSNodePool<T>::releaseAll(){
+    for(int i = 0; i < chunks.getNumIndexes(); i++){
+        ::operator delete(chunks.getData()[i]);
+    }
+
+    chunks.clear();
+    next = nullptr;
+    end = nullptr;
+    freeList = nullptr;
+    chunkSize = FIRST_CHUNK;
+}
+
+/**
+ * @brief ~DSNodePool - destructor, frees every chunk
+ */
+template <class T>
+DSNodePool<T>::~DSNodePool(){
+    releaseAll();
+}
+
+#endif // DSNODEPOOL_H
@@ -0,0 +1,106 @@
+#ifndef DSHASH_H
+#define DSHASH_H
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+
+#include "../DSString/dsstring.h"
+#include "../DSStringView/dsstringview.h"
+
+/**
+ * @brief The DSHash struct - hash functor used by the hashed containers, defaults to std::hash
+ */
+template <class T>
+struct DSHash{
+    /**
+     * @brief operator () - returns the hash of the given value
+     * @param value - value to hash
+     * @return hash of value
+     */
+    size_t operator()(const T& value) const{
+        return std::hash<T>()(value);
+    }
+};
+
+/**
+ * @brief The DSHash<DSString> struct - hashes the string's characters eight at a time
+ *
+ * Each word of characters is folded in with a multiply and a shift, and the result goes through the murmur3
+ * finalizer so every input bit reaches the high bits DSHashMap picks slots with. Views and raw characters hash the
+ * same as a string holding them, so a string keyed container can be searched without building a string.
+ */
+template <>
+struct DSHash<DSString>{
+    /**
+     * @brief operator () - returns the hash of the given string
+     * @param value - string to hash
+     * @return hash of value
+     */
+    size_t operator()(const DSString& value) const{
+        return (*this)(value.c_str(), value.size());
+    }
+
+    /**
+     * @brief operator () - returns the hash of the given view, equal to the hash of the same string
+     * @param value - view to hash
+     * @return hash of value
+     */
+    size_t operator()(const DSStringView& value) const{
+        return (*this)(value.data(), value.size());
+    }
+
+    /**
+     * @brief operator () - returns the hash of the given characters, equal to the hash of the same string
+     * @param value - characters to hash, need not be null terminated
+     * @param length - number of characters
+     * @return hash of value
+     */
+    size_t operator()(const char* value, const int length) const{
+        const unsigned long long multiplier = 0x9E3779B97F4A7C15ull;
+        unsigned long long hash = 0x243F6A8885A308D3ull ^ (static_cast<unsigned long long>(length) * multiplier);
+
+        int i = 0;
+        for(; i + 8 <= length; i += 8){
+            unsigned long long word;
+            std::memcpy(&word, value + i, 8);
+
+            hash = (hash ^ word) * multiplier;
+            hash ^= hash >> 32;
+        }
+
+        // the last few characters, zero padded, the length above keeps padding from colliding
+        if(i < length){
+            unsigned long long word = 0;
+            std::memcpy(&word, value + i, length - i);
+
+            hash = (hash ^ word) * multiplier;
+            hash ^= hash >> 32;
+        }
+
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ull;
+        hash ^= hash >> 33;
+
+        return static_cast<size_t>(hash);
+    }
+};
+
+/**
+ * @brief The DSHash<DSStringView> struct - hashes a view the same as a DSString holding its characters
+ */
+template <>
+struct DSHash<DSStringView>{
+    /**
+     * @brief operator () - returns the hash of the given view
+     * @param value - view to hash
+     * @return hash of value
+     */
+    size_t operator()(const DSStringView& value) const{
+        return DSHash<DSString>()(value.data(), value.size());
+    }
+};
+
+#endif // DSHASH_H
@@ -0,0 +1,582 @@
+#ifndef DSHASHMAP_H
+#define DSHASHMAP_H
+
+#include <cstddef>
+#include <utility>
+
+#include "../DSHash/dshash.h"
+#include "../DSVector/dsvector.h"
+
+/**
+ * @brief The DSHashMap class - open addressing hash map with its entries stored contiguously
+ *
+ * Entries live in a flat vector in insertion order, and a power of two table of eight byte slots holds each entry's
+ * index and the top 32 bits of its hash times a large odd constant. Lookups probe linearly from the slot given by
+ * the top bits of that product and only touch an entry when the stored bits match, so weak hashes such as the
+ * identity hash of an int still spread out. Erasing shifts the following slots back instead of leaving markers,
+ * and moves the last entry into the hole, so entry indices are stable until something is erased.
+ *
+ * Every lookup takes any key type the Hash functor accepts and that compares equal to K with ==, so a DSString keyed
+ * map can be searched with a DSStringView. clear keeps the storage, so a map can be reused as the visited or label
+ * set of repeated searches without allocating.
+ */
+template <class K, class V, class Hash = DSHash<K>>
+class DSHashMap
+{
+public:
+    /**
+     * @brief The Entry struct - a key and its value
+     */
+    struct Entry{
+        K key;
+        V value;
+    };
+
+    /**
+     * @brief DSHashMap - default constructor, creates an empty map without allocating
+     */
+    DSHashMap();
+
+    /**
+     * @brief DSHashMap - copy constructor
+     * @param other - map to copy
+     */
+    DSHashMap(const DSHashMap<K, V, Hash>& other);
+
+    /**
+     * @brief DSHashMap - move constructor, takes other's storage and leaves it empty
+     * @param other - map to move from
+     */
+    DSHashMap(DSHashMap<K, V, Hash>&& other) noexcept;
+
+    /**
+     * @brief size - returns the number of entries
+     * @return number of entries
+     */
+    int size() const;
+
+    /**
+     * @brief reserve - makes room for the given number of entries without growing the table again
+     * @param count - number of entries expected
+     */
+    void reserve(const int count);
+
+    /**
+     * @brief clear - removes every entry, the storage is kept
+     */
+    void clear();
+
+    /**
+     * @brief find - returns the value stored for a key
+     * @param key - key to look up
+     * @return pointer to the value, nullptr if the key is not stored
+     */
+    template <class Q>
+    V* find(const Q& key);
+
+    /**
+     * @brief find - returns the value stored for a key
+     * @param key - key to look up
+     * @return pointer to the value, nullptr if the key is not stored
+     */
+    template <class Q>
+    const V* find(const Q& key) const;
+
+    /**
+     * @brief indexOf - returns the index of a key's entry
+     * @param key - key to look up
+     * @return index of the entry, -1 if the key is not stored
+     */
+    template <class Q>
+    int indexOf(const Q& key) const;
+
+    /**
+     * @brief contains - returns true if a key is stored
+     * @param key - key to look up
+     * @return true if the key is stored
+     */
+    template <class Q>
+    bool contains(const Q& key) const;
+
+    /**
+     * @brief insert - stores a value for a key that is not stored yet, the key is only converted to K if it is new
+     * @param key - key to store
+     * @param value - value to store if the key is new
+     * @return index of the key's entry, holding the existing value if the key was already stored
+     */
+    template <class Q>
+    int insert(const Q& key, const V& value);
+
+    /**
+     * @brief operator [] - returns the value of a key, storing a default value first if the key is new
+     * @param key - key to look up
+     * @return reference to the value
+     */
+    V& operator[](const K& key);
+
+    /**
+     * @brief erase - removes a key and its value, the last entry takes the removed entry's index
+     * @param key - key to remove
+     * @return true if the key was stored
+     */
+    template <class Q>
+    bool erase(const Q& key);
+
+    /**
+     * @brief entryAt - returns the entry at the given index
+     * @param index - index of the entry, below size()
+     * @return reference to the entry
+     */
+    Entry& entryAt(const int index);
+
+    /**
+     * @brief entryAt - returns the entry at the given index
+     * @param index - index of the entry, below size()
+     * @return reference to the entry
+     */
+    const Entry& entryAt(const int index) const;
+
+    /**
+     * @brief operator = : sets this map equal to the given map
+     * @param other - map to copy
+     * @return reference to this map
+     */
+    DSHashMap<K, V, Hash>& operator=(const DSHashMap<K, V, Hash>& other);
+
+    /**
+     * @brief operator = : takes the given map's storage and leaves it empty
+     * @param other - map to move from
+     * @return reference to this map
+     */
+    DSHashMap<K, V, Hash>& operator=(DSHashMap<K, V, Hash>&& other) noexcept;
+
+    /**
+     * @brief ~DSHashMap - destructor
+     */
+    ~DSHashMap();
+
+    inline Entry* begin(){
+        return entries.getData();
+    }
+
+    inline Entry* end(){
+        return entries.getData() + entries.getNumIndexes();
+    }
+
+    inline const Entry* begin() const{
+        return entries.getData();
+    }
+
+    inline const Entry* end() const{
+        return entries.getData() + entries.getNumIndexes();
+    }
+
+private:
+    /**
+     * @brief The Slot struct - index of an entry and its mixed hash, entry is -1 for an empty slot
+     */
+    struct Slot{
+        unsigned int hash;
+        int entry;
+    };
+
+    DSVector<Entry> entries;
+
+    Slot* slots = nullptr;
+    int capacity = 0;
+    // 32 minus log2(capacity), so the mixed hash's top bits index the table
+    int shift = 32;
+
+    Hash hasher;
+
+    /**
+     * @brief mixHash - returns the bits of a key's hash that are stored in its slot
+     * @param hash - hash of a key
+     * @return mixed hash
+     */
+    static unsigned int mixHash(const size_t hash);
+
+    /**
+     * @brief homeSlot - returns the slot probing for a mixed hash starts at
+     * @param hash - mixed hash of a key
+     * @return index of the slot
+     */
+    int homeSlot(const unsigned int hash) const;
+
+    /**
+     * @brief findSlot - returns the slot holding a key or the empty slot where probing stopped
+     * @param key - key to look up
+     * @param hash - mixed hash of key
+     * @return index of the slot
+     */
+    template <class Q>
+    int findSlot(const Q& key, const unsigned int hash) const;
+
+    /**
+     * @brief rehash - moves every slot into a new table
+     * @param newCapacity - number of slots, must be a power of two
+     */
+    void rehash(const int newCapacity);
+};
+
+/**
+ * @brief DSHashMap - default constructor, creates an empty map without allocating
+ */
+template <class K, class V, class Hash>
+DSHashMap<K, V, Hash>::DSHashMap(){}
+
+/**
+ * @brief DSHashMap - copy constructor
+ * @param other - map to copy
+ */
+template <class K, class V, class Hash>
+DSHashMap<K, V, Hash>::DSHashMap(const DSHashMap<K, V, Hash>& other){
+    *this = other;
+}
+
+/**
+ * @brief DSHashMap - move constructor, takes other's storage and leaves it empty
+ * @param other - map to move from
+ */
+template <class K, class V, class Hash>
+DSHashMap<K, V, Hash>::DSHashMap(DSHashMap<K, V, Hash>&& other) noexcept{
+    *this = std::move(other);
+}
+
+/**
+ * @brief size - returns the number of entries
+ * @return number of entries
+ */
+template <class K, class V, class Hash>
+int DSHashMap<K, V, Hash>::size() const{
+    return entries.getNumIndexes();
+}
+
+/**
+ * @brief reserve - reserves the entries and doubles the table until it stays at most half full
+ * @param count - number of entries expected
+ */
+template <class K, class V, class Hash>
+void DSHashMap<K, V, Hash>::reserve(const int count){
+    entries.reserve(count);
+
+    int newCapacity = capacity == 0 ? 16 : capacity;
+    while((count + 1) * 2 > newCapacity){
+        newCapacity *= 2;
+    }
+
+    if(newCapacity != capacity){
+        rehash(newCapacity);
+    }
+}
+
+/**
+ * @brief clear - destroys the entries and empties every slot, the storage is kept
+ */
+template <class K, class V, class Hash>
+void DSHashMap<K, V, Hash>::clear(){
+    entries.clear();
+
+    for(int i = 0; i < capacity; i++){
+        slots[i].entry = -1;
+    }
+}
+
+/**
+ * @brief find - returns the value stored for a key
+ * @param key - key to look up
+ * @return pointer to the value, nullptr if the key is not stored
+ */
+template <class K, class V, class Hash>
+template <class Q>
+V* DSHashMap<K, V, Hash>::find(const Q& key){
+    int index = indexOf(key);
+
+    return index == -1 ? nullptr : &entries.getData()[index].value;
+}
+
+/**
+ * @brief find - returns the value stored for a key
+ * @param key - key to look up
+ * @return pointer to the value, nullptr if the key is not stored
+ */
+template <class K, class V, class Hash>
+template <class Q>
+const V* DSHashMap<K, V, Hash>::find(const Q& key) const{
+    int index = indexOf(key);
+
+    return index == -1 ? nullptr : &entries.getData()[index].value;
+}
+
+/**
+ * @brief indexOf - hashes the key once and probes for it
+ * @param key - key to look up
+ * @return index of the entry, -1 if the key is not stored
+ */
+template <class K, class V, class Hash>
+template <class Q>
+int DSHashMap<K, V, Hash>::indexOf(const Q& key) const{
+    if(entries.getNumIndexes() == 0){
+        return -1;
+    }
+
+    return slots[findSlot(key, mixHash(hasher(key)))].entry;
+}
+
+/**
+ * @brief contains - returns true if a key is stored
+ * @param key - key to look up
+ * @return true if the key is stored
+ */
+template <class K, class V, class Hash>
+template <class Q>
+bool DSHashMap<K, V, Hash>::contains(const Q& key) const{
+    return indexOf(key) != -1;
+}
+
+/**
+ * @brief insert - grows the table past half full, then probes once and appends a new entry to the empty slot found
+ * @param key - key to store
+ * @param value - value to store if the key is new
+ * @return index of the key's entry, holding the existing value if the key was already stored
+ */
+template <class K, class V, class Hash>
+template <class Q>
+int DSHashMap<K, V, Hash>::insert(const Q& key, const V& value){
+    if((entries.getNumIndexes() + 1) * 2 > capacity){
+        rehash(capacity == 0 ? 16 : capacity * 2);
+    }
+
+    unsigned int hash = mixHash(hasher(key));
+    int slot = findSlot(key, hash);
+
+    if(slots[slot].entry == -1){
+        slots[slot].hash = hash;
+        slots[slot].entry = entries.getNumIndexes();
+
+        Entry& entry = entries.emplaceBack();
+        entry.key = K(key);
+        entry.value = value;
+    }
+
+    return slots[slot].entry;
+}
+
+/**
+ * @brief operator [] - returns the value of a key, storing a default value first if the key is new
+ * @param key - key to look up
+ * @return reference to the value
+ */
+template <class K, class V, class Hash>
+V& DSHashMap<K, V, Hash>::operator[](const K& key){
+    // inserting may move the entries, so the index is taken before the data pointer
+    int index = insert(key, V());
+
+    return entries.getData()[index].value;
+}
+
+/**
+ * @brief erase - empties the key's slot and shifts back every following slot of the probe run that may move into
+ * it, then moves the last entry into the removed entry's index
+ * @param key - key to remove
+ * @return true if the key was stored
+ */
+template <class K, class V, class Hash>
+template <class Q>
+bool DSHashMap<K, V, Hash>::erase(const Q& key){
+    if(entries.getNumIndexes() == 0){
+        return false;
+    }
+
+    int hole = findSlot(key, mixHash(hasher(key)));
+    int removed = slots[hole].entry;
+    if(removed == -1){
+        return false;
+    }
+
+    int mask = capacity - 1;
+    for(int i = (hole + 1) & mask; slots[i].entry != -1; i = (i + 1) & mask){
+        // a slot may only move back if its home is not between the hole and itself
+        int home = homeSlot(slots[i].hash);
+        if(((i - home) & mask) >= ((i - hole) & mask)){
+            slots[hole] = slots[i];
+            hole = i;
+        }
+    }
+    slots[hole].entry = -1;
+
+    int last = entries.getNumIndexes() - 1;
+    if(removed != last){
+        Entry* entryData = entries.getData();
+        entryData[removed] = std::move(entryData[last]);
+
+        for(int i = homeSlot(mixHash(hasher(entryData[removed].key))); ; i = (i + 1) & mask){
+            if(slots[i].entry == last){
+                slots[i].entry = removed;
+                break;
+            }
+        }
+    }
+    entries.removeLast();
+
+    return true;
+}
+
+/**
+ * @brief entryAt - returns the entry at the given index
+ * @param index - index of the entry, below size()
+ * @return reference to the entry
+ */
+template <class K, class V, class Hash>
+typename DSHashMap<K, V, Hash>::Entry& DSHashMap<K, V, Hash>::entryAt(const int index){
+    return entries.getData()[index];
+}
+
+/**
+ * @brief entryAt - returns the entry at the given index
+ * @param index - index of the entry, below size()
+ * @return reference to the entry
+ */
+template <class K, class V, class Hash>
+const typename DSHashMap<K, V, Hash>::Entry& DSHashMap<K, V, Hash>::entryAt(const int index) const{
+    return entries.getData()[index];
+}
+
+/**
+ * @brief operator = : copies the entries and the slot table of the given map
+ * @param other - map to copy
+ * @return reference to this map
+ */
+template <class K, class V, class Hash>
+DSHashMap<K, V, Hash>& DSHashMap<K, V, Hash>::operator=(const DSHashMap<K, V, Hash>& other){
+    if(this == &other){
+        return *this;
+    }
+
+    entries = other.entries;
+
+    if(capacity != other.capacity){
+        delete[] slots;
+        slots = other.capacity == 0 ? nullptr : new Slot[other.capacity];
+        capacity = other.capacity;
+        shift = other.shift;
+    }
+
+    for(int i = 0; i < capacity; i++){
+        slots[i] = other.slots[i];
+    }
+
+    return *this;
+}
+
+/**
+ * @brief operator = : takes the given map's storage and leaves it empty
+ * @param other - map to move from
+ * @return reference to this map
+ */
+template <class K, class V, class Hash>
+DSHashMap<K, V, Hash>& DSHashMap<K, V, Hash>::operator=(DSHashMap<K, V, Hash>&& other) noexcept{
+    if(this == &other){
+        return *this;
+    }
+
+    entries = std::move(other.entries);
+
+    delete[] slots;
+    slots = other.slots;
+    capacity = other.capacity;
+    shift = other.shift;
+
+    other.slots = nullptr;
+    other.capacity = 0;
+    other.shift = 32;
+
+    return *this;
+}
+
+/**
+ * @brief ~DSHashMap - destructor
+ */
+template <class K, class V, class Hash>
+DSHashMap<K, V, Hash>::~DSHashMap(){
+    delete[] slots;
+}
+
+/**
+ * @brief mixHash - multiplies by 2^64 divided by the golden ratio and keeps the top 32 bits
+ * @param hash - hash of a key
+ * @return mixed hash
+ */
+template <class K, class V, class Hash>
+unsigned int DSHashMap<K, V, Hash>::mixHash(const size_t hash){
+    return static_cast<unsigned int>((static_cast<unsigned long long>(hash) * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
+/**
+ * @brief homeSlot - returns the top bits of the mixed hash
+ * @param hash - mixed hash of a key
+ * @return index of the slot
+ */
+template <class K, class V, class Hash>
+int DSHashMap<K, V, Hash>::homeSlot(const unsigned int hash) const{
+    return static_cast<int>(hash >> shift);
+}
+
+/**
+ * @brief findSlot - linearly probes from the home slot, comparing keys only when the stored hashes match
+ * @param key - key to look up
+ * @param hash - mixed hash of key
+ * @return index of the slot
+ */
+template <class K, class V, class Hash>
+template <class Q>
+int DSHashMap<K, V, Hash>::findSlot(const Q& key, const unsigned int hash) const{
+    const Entry* entryData = entries.getData();
+
+    int mask = capacity - 1;
+    for(int i = homeSlot(hash); ; i = (i + 1) & mask){
+        const Slot& slot = slots[i];
+
+        if(slot.entry == -1 || (slot.hash == hash && entryData[slot.entry].key == key)){
+            return i;
+        }
+    }
+}
+
+/**
+ * @brief rehash - reinserts every used slot into a new table using the stored hashes
+ * @param newCapacity - number of slots, must be a power of two
+ */
+template <class K, class V, class Hash>
+void DSHashMap<K, V, Hash>::rehash(const int newCapacity){
+    Slot* oldSlots = slots;
+    int oldCapacity = capacity;
+
+    slots = new Slot[newCapacity];
+    capacity = newCapacity;
+    shift = 32;
+    for(int bits = newCapacity; bits > 1; bits >>= 1){
+        shift--;
+    }
+
+    for(int i = 0; i < capacity; i++){
+        slots[i].entry = -1;
+    }
+
+    int mask = capacity - 1;
+    for(int i = 0; i < oldCapacity; i++){
+        if(oldSlots[i].entry == -1){
+            continue;
+        }
+
+        int j = homeSlot(oldSlots[i].hash);
+        while(slots[j].entry != -1){
+            j = (j + 1) & mask;
+        }
+        slots[j] = oldSlots[i];
+    }
+
+    delete[] oldSlots;
+}
+
+#endif // DSHASHMAP_H
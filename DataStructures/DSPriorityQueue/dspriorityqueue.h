@@ -0,0 +1,370 @@
+#ifndef DSPRIORITYQUEUE_H
+#define DSPRIORITYQUEUE_H
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "../DSVector/dsvector.h"
+
+/**
+ * @brief The DSPriorityQueue class - 4-ary heap of keyed values with decrease-key
+ *
+ * Values are small non-negative ids, such as airport, flight or label indices, and each one is queued at most once.
+ * The heap is stored contiguously, and a position table indexed by id follows every move, so a queued value can
+ * have its key lowered in place instead of being pushed again and skipped as stale when it is popped. A node's four
+ * children share a cache line, which makes the heap shallower than a binary one for the same sift down cost.
+ *
+ * Compare returns true if its first key comes out before its second, so the default std::less makes a min-heap,
+ * the opposite of std::priority_queue. Passing a comparator lets one key type be ranked by time or by cost. clear
+ * keeps the storage, so a queue can serve every query of a search without allocating again.
+ */
+template <class K, class V, class Compare = std::less<K>>
+class DSPriorityQueue
+{
+    static_assert(std::is_integral<V>::value, "DSPriorityQueue values are ids that index the position table");
+
+public:
+    /**
+     * @brief DSPriorityQueue - constructor, creates an empty queue without allocating
+     * @param compare - returns true if its first key comes out before its second
+     */
+    explicit DSPriorityQueue(const Compare& compare = Compare());
+
+    /**
+     * @brief size - returns the number of queued values
+     * @return number of queued values
+     */
+    int size() const;
+
+    /**
+     * @brief empty - returns true if no value is queued
+     * @return true if the queue is empty
+     */
+    bool empty() const;
+
+    /**
+     * @brief reserve - makes room for the given number of values and ids below it without reallocating
+     * @param count - number of values expected
+     */
+    void reserve(const int count);
+
+    /**
+     * @brief clear - removes every value, the storage is kept
+     */
+    void clear();
+
+    /**
+     * @brief contains - returns true if a value is queued
+     * @param value - id to look for
+     * @return true if the value is queued
+     */
+    bool contains(const V& value) const;
+
+    /**
+     * @brief keyOf - returns the key a value is queued with, the value must be queued
+     * @param value - queued id
+     * @return key of the value
+     */
+    const K& keyOf(const V& value) const;
+
+    /**
+     * @brief push - queues a value that is not queued yet
+     * @param key - key of the value
+     * @param value - id to queue
+     */
+    void push(const K& key, const V& value);
+
+    /**
+     * @brief decreaseKey - moves a queued value up to a key that comes out no later than its current one
+     * @param value - queued id
+     * @param key - new key of the value
+     */
+    void decreaseKey(const V& value, const K& key);
+
+    /**
+     * @brief pushOrDecrease - queues a value, or lowers its key if it is queued with a later one
+     * @param key - key of the value
+     * @param value - id to queue
+     * @return true if the value was queued or its key lowered
+     */
+    bool pushOrDecrease(const K& key, const V& value);
+
+    /**
+     * @brief topKey - returns the key that comes out first, the queue must not be empty
+     * @return key of the top value
+     */
+    const K& topKey() const;
+
+    /**
+     * @brief topValue - returns the value that comes out first, the queue must not be empty
+     * @return top value
+     */
+    const V& topValue() const;
+
+    /**
+     * @brief pop - removes the top value, popping an empty queue does nothing
+     */
+    void pop();
+
+private:
+    /**
+     * @brief The Node struct - a queued value and its key
+     */
+    struct Node{
+        K key;
+        V value;
+    };
+
+    static const int ARITY = 4;
+
+    DSVector<Node> heap;
+
+    // index in heap of every id, -1 while it is not queued
+    DSVector<int> positions;
+
+    Compare compare;
+
+    /**
+     * @brief siftUp - moves a node towards the root until its parent comes out before it
+     * @param index - index of the node
+     */
+    void siftUp(int index);
+
+    /**
+     * @brief siftDown - moves a node towards the leaves until none of its children comes out before it
+     * @param index - index of the node, only the root is sifted down
+     */
+    void siftDown(int index);
+};
+
+/**
+ * @brief DSPriorityQueue - constructor, creates an empty queue without allocating
+ * @param compare - returns true if its first key comes out before its second
+ */
+template <class K, class V, class Compare>
+DSPriorityQueue<K, V, Compare>::DSPriorityQueue(const Compare& compare) : compare(compare){}
+
+/**
+ * @brief size - returns the number of queued values
+ * @return number of queued values
+ */
+template <class K, class V, class Compare>
+int DSPriorityQueue<K, V, Compare>::size() const{
+    return heap.getNumIndexes();
+}
+
+/**
+ * @brief empty - returns true if no value is queued
+ * @return true if the queue is empty
+ */
+template <class K, class V, class Compare>
+bool DSPriorityQueue<K, V, Compare>::empty() const{
+    return heap.getNumIndexes() == 0;
+}
+
+/**
+ * @brief reserve - grows the heap and the position table, never shrinks them
+ * @param count - number of values expected
+ */
+template <class K, class V, class Compare>
+void DSPriorityQueue<K, V, Compare>::reserve(const int count){
+    heap.reserve(count);
+    positions.reserve(count);
+    while(positions.getNumIndexes() < count){
+        positions.pushBack(-1);
+    }
+}
+
+/**
+ * @brief clear - forgets the position of every queued value and empties the heap, so it costs the number of queued
+ * values rather than the size of the position table
+ */
+template <class K, class V, class Compare>
+void DSPriorityQueue<K, V, Compare>::clear(){
+    const Node* heapData = heap.getData();
+    int* positionData = positions.getData();
+
+    for(int i = 0; i < heap.getNumIndexes(); i++){
+        positionData[static_cast<int>(heapData[i].value)] = -1;
+    }
+
+    heap.clear();
+}
+
+/**
+ * @brief contains - returns true if a value is queued
+ * @param value - id to look for
+ * @return true if the value is queued
+ */
+template <class K, class V, class Compare>
+bool DSPriorityQueue<K, V, Compare>::contains(const V& value) const{
+    int id = static_cast<int>(value);
+
+    return id < positions.getNumIndexes() && positions.getData()[id] != -1;
+}
+
+/**
+ * @brief keyOf - returns the key a value is queued with, the value must be queued
+ * @param value - queued id
+ * @return key of the value
+ */
+template <class K, class V, class Compare>
+const K& DSPriorityQueue<K, V, Compare>::keyOf(const V& value) const{
+    return heap.getData()[positions.getData()[static_cast<int>(value)]].key;
+}
+
+/**
+ * @brief push - grows the position table up to the id if needed, appends the node and sifts it up
+ * @param key - key of the value
+ * @param value - id to queue
+ */
+template <class K, class V, class Compare>
+void DSPriorityQueue<K, V, Compare>::push(const K& key, const V& value){
+    int id = static_cast<int>(value);
+    while(positions.getNumIndexes() <= id){
+        positions.pushBack(-1);
+    }
+
+    heap.emplaceBack(Node{key, value});
+    siftUp(heap.getNumIndexes() - 1);
+}
+
+/**
+ * @brief decreaseKey - replaces the key of a queued value and sifts it up
+ * @param value - queued id
+ * @param key - new key of the value
+ */
+template <class K, class V, class Compare>
+void DSPriorityQueue<K, V, Compare>::decreaseKey(const V& value, const K& key){
+    int index = positions.getData()[static_cast<int>(value)];
+
+    heap.getData()[index].key = key;
+    siftUp(index);
+}
+
+/**
+ * @brief pushOrDecrease - queues a value, or lowers its key if it is queued with a later one
+ * @param key - key of the value
+ * @param value - id to queue
+ * @return true if the value was queued or its key lowered
+ */
+template <class K, class V, class Compare>
+bool DSPriorityQueue<K, V, Compare>::pushOrDecrease(const K& key, const V& value){
+    if(!contains(value)){
+        push(key, value);
+        return true;
+    }
+
+    if(!compare(key, keyOf(value))){
+        return false;
+    }
+
+    decreaseKey(value, key);
+    return true;
+}
+
+/**
+ * @brief topKey - returns the key of the root
+ * @return key of the top value
+ */
+template <class K, class V, class Compare>
+const K& DSPriorityQueue<K, V, Compare>::topKey() const{
+    return heap.getData()[0].key;
+}
+
+/**
+ * @brief topValue - returns the value of the root
+ * @return top value
+ */
+template <class K, class V, class Compare>
+const V& DSPriorityQueue<K, V, Compare>::topValue() const{
+    return heap.getData()[0].value;
+}
+
+/**
+ * @brief pop - moves the last node into the root and sifts it down
+ */
+template <class K, class V, class Compare>
+void DSPriorityQueue<K, V, Compare>::pop(){
+    if(heap.getNumIndexes() == 0){
+        return;
+    }
+
+    Node* heapData = heap.getData();
+    positions.getData()[static_cast<int>(heapData[0].value)] = -1;
+
+    int last = heap.getNumIndexes() - 1;
+    if(last > 0){
+        heapData[0] = std::move(heapData[last]);
+    }
+    heap.removeLast();
+
+    if(last > 0){
+        siftDown(0);
+    }
+}
+
+/**
+ * @brief siftUp - shifts parents down into the hole until the node's place is found, writing each moved node's
+ * position once
+ * @param index - index of the node
+ */
+template <class K, class V, class Compare>
+void DSPriorityQueue<K, V, Compare>::siftUp(int index){
+    Node* heapData = heap.getData();
+    int* positionData = positions.getData();
+    Node node = std::move(heapData[index]);
+
+    while(index > 0){
+        int parent = (index - 1) / ARITY;
+        if(!compare(node.key, heapData[parent].key)){
+            break;
+        }
+
+        heapData[index] = std::move(heapData[parent]);
+        positionData[static_cast<int>(heapData[index].value)] = index;
+        index = parent;
+    }
+
+    positionData[static_cast<int>(node.value)] = index;
+    heapData[index] = std::move(node);
+}
+
+/**
+ * @brief siftDown - moves the hole left by the root down to a leaf, always through the child that comes out first,
+ * then sifts the node back up from there. The node placed at the root comes from the bottom of the heap and usually
+ * belongs near it again, so this skips comparing it against the children on the way down
+ * @param index - index of the node
+ */
+template <class K, class V, class Compare>
+void DSPriorityQueue<K, V, Compare>::siftDown(int index){
+    Node* heapData = heap.getData();
+    int* positionData = positions.getData();
+    int count = heap.getNumIndexes();
+    Node node = std::move(heapData[index]);
+
+    while(true){
+        int first = index * ARITY + 1;
+        if(first >= count){
+            break;
+        }
+
+        int end = first + ARITY < count ? first + ARITY : count;
+        int best = first;
+        for(int child = first + 1; child < end; child++){
+            if(compare(heapData[child].key, heapData[best].key)){
+                best = child;
+            }
+        }
+
+        heapData[index] = std::move(heapData[best]);
+        positionData[static_cast<int>(heapData[index].value)] = index;
+        index = best;
+    }
+
+    heapData[index] = std::move(node);
+    siftUp(index);
+}
+
+#endif // DSPRIORITYQUEUE_H
@@ -1,9 +1,16 @@
-#ifndef DSLISTSTACK_H
-#define DSLISTSTACK_H
+#ifndef DSSTACK_H
+#define DSSTACK_H
 
-#include "../DSDoublyLL/dsdoublyll.h"
+#include <utility>
 
+#include "../DSVector/dsvector.h"
 
+/**
+ * @brief The DSStack class - stack stored contiguously in a DSVector, the top is the last element
+ *
+ * Pushing only allocates when the vector grows, and clear keeps the storage, so a stack reserved once can be reused
+ * by every query of a search without allocating again.
+ */
 template <class T>
 class DSStack
 {
@@ -18,6 +25,12 @@ public:
      */
     DSStack(const DSStack<T>& other);
 
+    /**
+     * @brief DSStack - move constructor, takes other's storage and leaves it empty
+     * @param other - stack to move from
+     */
+    DSStack(DSStack<T>&& other) noexcept;
+
     /**
      * @brief ~DSStack - destructor
      */
@@ -28,11 +41,42 @@ public:
      */
     int size() const;
 
+    /**
+     * @brief empty - returns true if the stack has no elements
+     * @return true if the stack is empty
+     */
+    bool empty() const;
+
+    /**
+     * @brief reserve - makes room for the given number of elements without reallocating
+     * @param capacity - number of elements expected
+     */
+    void reserve(const int capacity);
+
+    /**
+     * @brief clear - removes every element, the storage is kept
+     */
+    void clear();
+
     /**
      * @brief push - adds an element to the top of the stack
      * @param element - element to add to stack
      */
-    void push(const T element);
+    void push(const T& element);
+
+    /**
+     * @brief push - moves an element onto the top of the stack
+     * @param element - element to add to stack
+     */
+    void push(T&& element);
+
+    /**
+     * @brief emplace - constructs an element on the top of the stack
+     * @param args - arguments passed to T's constructor
+     * @return reference to the new element
+     */
+    template <class... Args>
+    T& emplace(Args&&... args);
 
     /**
      * @brief pop - removes the top element of the stack
@@ -43,7 +87,19 @@ public:
      * @brief peek - returns the top element of the stack
      * @return top element of the stack
      */
-    T peek() const;
+    const T& peek() const;
+
+    /**
+     * @brief top - returns the top element of the stack, the stack must not be empty
+     * @return reference to the top element
+     */
+    T& top();
+
+    /**
+     * @brief top - returns the top element of the stack, the stack must not be empty
+     * @return reference to the top element
+     */
+    const T& top() const;
 
     /**
      * @brief operator = :  Sets this stack equal to the passed in stack
@@ -52,6 +108,13 @@ public:
      */
     DSStack<T>& operator=(const DSStack<T>& other);
 
+    /**
+     * @brief operator = : takes the given stack's storage and leaves it empty
+     * @param other - stack to move from
+     * @return reference to this stack
+     */
+    DSStack<T>& operator=(DSStack<T>&& other) noexcept;
+
     /**
      * @brief operator + : returns a stack combining this and the given stack
      * @param other - reference to given stack
@@ -74,7 +137,7 @@ public:
     bool operator==(const DSStack<T>& other) const;
 
 private:
-    DSDoublyLL<T> data;
+    DSVector<T> data;
 };
 
 /**
@@ -87,9 +150,14 @@ DSStack<T>::DSStack(){}
  * @param other - reference to target stack
  */
 template <class T>
-DSStack<T>::DSStack(const DSStack<T>& other){
-    data = other->data;
-}
+DSStack<T>::DSStack(const DSStack<T>& other) : data(other.data){}
+
+/**
+ * @brief DSStack - move constructor, takes other's storage and leaves it empty
+ * @param other - stack to move from
+ */
+template <class T>
+DSStack<T>::DSStack(DSStack<T>&& other) noexcept : data(std::move(other.data)){}
 
 /**
  * @brief ~DSStack - destructor
@@ -102,7 +170,33 @@ DSStack<T>::~DSStack(){}
  */
 template <class T>
 int DSStack<T>::size() const{
-    return data.size();
+    return data.getNumIndexes();
+}
+
+/**
+ * @brief empty - returns true if the stack has no elements
+ * @return true if the stack is empty
+ */
+template <class T>
+bool DSStack<T>::empty() const{
+    return data.getNumIndexes() == 0;
+}
+
+/**
+ * @brief reserve - makes room for the given number of elements without reallocating
+ * @param capacity - number of elements expected
+ */
+template <class T>
+void DSStack<T>::reserve(const int capacity){
+    data.reserve(capacity);
+}
+
+/**
+ * @brief clear - destroys every element, the storage is kept
+ */
+template <class T>
+void DSStack<T>::clear(){
+    data.clear();
 }
 
 /**
@@ -110,16 +204,38 @@ int DSStack<T>::size() const{
  * @param element - element to add to stack
  */
 template <class T>
-void DSStack<T>::push(const T element){
-    data.pushBack(element);
+void DSStack<T>::push(const T& element){
+    data.emplaceBack(element);
+}
+
+/**
+ * @brief push - moves an element onto the top of the stack
+ * @param element - element to add to stack
+ */
+template <class T>
+void DSStack<T>::push(T&& element){
+    data.emplaceBack(std::move(element));
+}
+
+/**
+ * @brief emplace - constructs an element on the top of the stack
+ * @param args - arguments passed to T's constructor
+ * @return reference to the new element
+ */
+template <class T>
+template <class... Args>
+T& DSStack<T>::emplace(Args&&... args){
+    return data.emplaceBack(std::forward<Args>(args)...);
 }
 
 /**
- * @brief pop - removes the top element of the stack
+ * @brief pop - removes the top element of the stack, popping an empty stack does nothing
  */
 template <class T>
 void DSStack<T>::pop(){
-    data.popBack();
+    if(data.getNumIndexes() > 0){
+        data.removeLast();
+    }
 }
 
 /**
@@ -127,8 +243,26 @@ void DSStack<T>::pop(){
  * @return top element of the stack
  */
 template <class T>
-T DSStack<T>::peek() const{
-    return data[size() - 1];
+const T& DSStack<T>::peek() const{
+    return top();
+}
+
+/**
+ * @brief top - returns the last element of the vector
+ * @return reference to the top element
+ */
+template <class T>
+T& DSStack<T>::top(){
+    return data.getData()[data.getNumIndexes() - 1];
+}
+
+/**
+ * @brief top - returns the last element of the vector
+ * @return reference to the top element
+ */
+template <class T>
+const T& DSStack<T>::top() const{
+    return data.getData()[data.getNumIndexes() - 1];
 }
 
 /**
@@ -143,6 +277,18 @@ DSStack<T>& DSStack<T>::operator=(const DSStack<T>& other){
     return *this;
 }
 
+/**
+ * @brief operator = : takes the given stack's storage and leaves it empty
+ * @param other - stack to move from
+ * @return reference to this stack
+ */
+template <class T>
+DSStack<T>& DSStack<T>::operator=(DSStack<T>&& other) noexcept{
+    data = std::move(other.data);
+
+    return *this;
+}
+
 /**
  * @brief operator + : returns a stack combining this and the given stack
  * @param other - reference to given stack
@@ -164,6 +310,8 @@ DSStack<T> DSStack<T>::operator+(const DSStack<T>& other) const{
 template <class T>
 DSStack<T>& DSStack<T>::operator+=(const DSStack<T>& other){
     data += other.data;
+
+    return *this;
 }
 
 
@@ -2,39 +2,42 @@
 
 #include <cstring>
 #include <iostream>
+#include <utility>
 
 // default constructor
 DSString::DSString() {
-    data = new char[1];
-    data[0] = '\0';
+    data = buffer;
+    length = 0;
+    capacity = INLINE_CAPACITY;
+    buffer[0] = '\0';
 }
 
 // constructor - parameters: const char* otherData
-DSString::DSString(const char* data) {
-    this->data = new char[unsigned(strlen(data)) + 1];
-
-    std::memcpy(this->data, data, strlen(data));
+DSString::DSString(const char* data) : DSString() {
+    assign(data, unsigned(strlen(data)));
+}
 
-    this->data[unsigned(strlen(data))] = '\0';
+// constructor - parameters: const char* otherData, const int length
+DSString::DSString(const char* data, const int length) : DSString() {
+    assign(data, length);
 }
 
 // constructor - parameters: const DSString otherData
-DSString::DSString(const DSString& other){
-    data = new char[other.size() + 1];
-
-    std::memcpy(data, other.data, strlen(other.data));
+DSString::DSString(const DSString& other) : DSString() {
+    assign(other.data, other.length);
+}
 
-    data[other.size()] = '\0';
+// move constructor - parameters: DSString&& other
+// heap characters change owner, inline ones are copied since they live inside other
+DSString::DSString(DSString&& other) noexcept : DSString() {
+    *this = std::move(other);
 }
 
 // returns the location of the passed char - parameters: const char searchChar
 int DSString::findChar(const char searchChar) const{
-    for(int i = 0; data[i] != '\0'; i++){
-        if(data[i] == searchChar){
-            return i;
-        }
-    }
-    return -1;
+    const char* found = static_cast<const char*>(std::memchr(data, searchChar, length));
+
+    return found == nullptr ? -1 : int(found - data);
 }
 
 // returns the location of the numInstance instance of the passed char - parameters: const char searchChar, const int numInstance
@@ -45,7 +48,7 @@ int DSString::findChar(const char searchChar, const int numInstance) const{
     }
 
     int currentInstances = 0;
-    for(int i = 0; data[i] != '\0'; i++){
+    for(int i = 0; i < length; i++){
         if(data[i] == searchChar){
             currentInstances++;
             if(currentInstances == numInstance){
@@ -56,33 +59,22 @@ int DSString::findChar(const char searchChar, const int numInstance) const{
     return -1;
 }
 
-// removes a char from the given index
+// removes a char from the given index, shifting the rest of the string in place
 void DSString::deleteIndex(const int index){
-    int newSize = size() - 1;
-    char* tempData = new char[newSize + 1];
-    tempData[newSize] = '\0';
-
-    std::memcpy(tempData, data, index);
-    std::strcpy(tempData + index, data + index + 1);
-
-    delete[] data;
-    data = tempData;
+    std::memmove(data + index, data + index + 1, length - index);
+    length--;
 }
 
 // default destructor
 DSString::~DSString() {
-    delete[] data;
+    if(!isInline()){
+        delete[] data;
+    }
 }
 
 // assignment operator - params: const char* data
 DSString& DSString::operator=(const char* data){
-    delete[] this->data;
-
-    this->data = new char[unsigned(strlen(data)) + 1];
-
-    std::memcpy(this->data, data, strlen(data));
-
-    this->data[unsigned(strlen(data))] = '\0';
+    assign(data, unsigned(strlen(data)));
 
     return *this;
 }
@@ -93,13 +85,38 @@ DSString& DSString::operator=(const DSString& other){
     if(this == &other){
         return *this;
     }
-    delete[] data;
 
-    data = new char[other.size() + 1];
+    assign(other.data, other.length);
 
-    std::memcpy(data, other.data, strlen(other.data));
+    return *this;
+}
 
-    data[other.size()] = '\0';
+// move assignment operator - params: DSString&& other
+DSString& DSString::operator=(DSString&& other) noexcept{
+    if(this == &other){
+        return *this;
+    }
+
+    if(other.isInline()){
+        std::memcpy(buffer, other.buffer, other.length + 1);
+        if(!isInline()){
+            delete[] data;
+        }
+        data = buffer;
+        capacity = INLINE_CAPACITY;
+    } else {
+        if(!isInline()){
+            delete[] data;
+        }
+        data = other.data;
+        capacity = other.capacity;
+    }
+    length = other.length;
+
+    other.data = other.buffer;
+    other.length = 0;
+    other.capacity = INLINE_CAPACITY;
+    other.buffer[0] = '\0';
 
     return *this;
 }
@@ -120,47 +137,30 @@ DSString DSString::operator+(const char data) const{
 
 // concatination operator - params: const DSString& data
 DSString DSString::operator+(const DSString& data) const{
-    DSString result = *this;
-    result += data;
+    DSString result;
+    result.reserve(length + data.length);
+    result.append(this->data, length);
+    result.append(data.data, data.length);
     return result;
 }
 
 // assign/concat operator - params: const char* data
 DSString& DSString::operator+=(const char* data){
-    int newSize = unsigned(strlen(data)) + size() + 1;
-
-    char* tempData = this->data;
-
-    this->data = new char[newSize];
-    this->data[0] = '\0';
-
-    std::strcat(this->data, tempData);
-    delete[] tempData;
-
-    std::strcat(this->data, data);
+    append(data, unsigned(strlen(data)));
 
     return *this;
 }
 
 // assign/concat operator - params: const char data
 DSString& DSString::operator+=(const char data){
-    int oldSize = unsigned(strlen(this->data));
-    char* oldData = this->data;
-
-    this->data = new char[oldSize + 2];
-
-    memcpy(this->data, oldData, oldSize);
-    delete[] oldData;
-
-    this->data[oldSize] = data;
-    this->data[oldSize + 1] = '\0';
+    append(&data, 1);
 
     return *this;
 }
 
 // assign/concat operator - params: const DSString& other
 DSString& DSString::operator+=(const DSString& other){
-    *this += other.c_str();
+    append(other.data, other.length);
 
     return *this;
 }
@@ -177,10 +177,7 @@ bool DSString::operator==(const char* other) const{
 
 // Comparison operator - params: const DSString& other
 bool DSString::operator==(const DSString& other) const{
-    if(strcmp(data, other.data) == 0){
-        return true;
-    }
-    return false;
+    return length == other.length && std::memcmp(data, other.data, length) == 0;
 }
 
 // less than operator - params: const char* other
@@ -254,7 +251,7 @@ char& DSString::operator[](const int index) const{
 
 // returns size of data array
 int DSString::size() const{
-    return unsigned(strlen(data));
+    return length;
 }
 
 // returns sub-string between the given indexes
@@ -282,35 +279,24 @@ DSString DSString::substring(int startingIndex, int len) const{
         }
     }
 
-    // if startingIndex is last index, return empty string
-    if(startingIndex == size() - 1){
+    // if startingIndex is past the last index, return empty string
+    if(startingIndex >= size()){
         DSString output;
         return output;
     }
 
-    char outputArray[len + 1];
-
-    memcpy(&outputArray, data + startingIndex, len);
-    outputArray[len] = '\0';
-
-    DSString output(outputArray);
-
-    return output;
+    return DSString(data + startingIndex, len);
 }
 
-// returns sub-string starting at the given index
+// returns sub-string starting at the given index, at most size() - 1 characters long
 DSString DSString::substring(int startingIndex) const{
     if(startingIndex > size() - 1){
         return "";
     }
-    char outputArray[size()];
 
-    memcpy(&outputArray, data + startingIndex, size());
-    outputArray[size() - 1] = '\0';
+    int len = size() - startingIndex < size() - 1 ? size() - startingIndex : size() - 1;
 
-    DSString output(outputArray);
-
-    return output;
+    return DSString(data + startingIndex, len);
 }
 
 // returns data cstring
@@ -320,7 +306,7 @@ char* DSString::c_str() const{
 
 // operator << - params: std::ostream& stream, const DSStrnig& theString
 std::ostream& operator<<(std::ostream& stream, const DSString& theString){
-    stream << theString.data;
+    stream.write(theString.data, theString.length);
 
     return stream;
 }
@@ -328,17 +314,62 @@ std::ostream& operator<<(std::ostream& stream, const DSString& theString){
 // operator >> - params: std::istream& stream, DSStrnig& theString
 std::istream& operator>>(std::istream& stream, DSString& theString){
     if(!stream.bad()){
-        char* buffer;
-        buffer = new char[500];
+        char buffer[500];
 
         stream.get(buffer, 500);
         // clear newline char
         stream.get();
 
         theString = buffer;
-
-        delete[] buffer;
     }
 
     return stream;
 }
+
+// returns true if the characters are stored in buffer
+bool DSString::isInline() const{
+    return data == buffer;
+}
+
+// makes room for at least needed characters, doubling so that appending one character at a time stays linear
+void DSString::reserve(const int needed){
+    if(needed <= capacity){
+        return;
+    }
+
+    int newCapacity = capacity * 2 > needed ? capacity * 2 : needed;
+    char* newData = new char[newCapacity + 1];
+
+    std::memcpy(newData, data, length + 1);
+
+    if(!isInline()){
+        delete[] data;
+    }
+
+    data = newData;
+    capacity = newCapacity;
+}
+
+// replaces the characters of the string, keeping its storage when they fit
+void DSString::assign(const char* characters, const int count){
+    length = 0;
+    data[0] = '\0';
+
+    append(characters, count);
+}
+
+// adds characters to the end of the string
+void DSString::append(const char* characters, const int count){
+    // characters may point into this string, which reserve can free
+    if(length + count > capacity && characters >= data && characters <= data + length){
+        DSString copy(characters, count);
+        append(copy.data, count);
+        return;
+    }
+
+    reserve(length + count);
+
+    std::memcpy(data + length, characters, count);
+    length += count;
+    data[length] = '\0';
+}
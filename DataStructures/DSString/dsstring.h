@@ -79,12 +79,25 @@ public:
      */
     DSString(const char* data);
 
+    /**
+     * @brief DSString - constructor
+     * @param data - characters to copy, need not be null terminated
+     * @param length - number of characters to copy
+     */
+    DSString(const char* data, const int length);
+
     /**
      * @brief DSString - copy constructor
      * @param other - string to copy
      */
     DSString(const DSString& other);
 
+    /**
+     * @brief DSString - move constructor, takes other's characters and leaves it empty
+     * @param other - string to move from
+     */
+    DSString(DSString&& other) noexcept;
+
     /**
      * @brief findChar - find the first instance of a character in string
      * @param searchChar - character to find
@@ -119,6 +132,8 @@ public:
     DSString& operator=(const char* data);
     // assignment operator - params: const DSString& other
     DSString& operator=(const DSString& other);
+    // move assignment operator, leaves other empty - params: DSString&& other
+    DSString& operator=(DSString&& other) noexcept;
 
     // concatination operator - params: const char* data
     DSString operator+(const char* data) const;
@@ -183,11 +198,44 @@ public:
     }
 
     inline iterator end(){
-        return iterator(data + size());
+        return iterator(data + length);
     }
 
 private:
+    // strings up to this many characters are stored in buffer instead of on the heap
+    static const int INLINE_CAPACITY = 15;
+
+    // points at buffer or at a heap array of capacity + 1 characters, always null terminated
     char* data;
+    int length;
+    int capacity;
+    char buffer[INLINE_CAPACITY + 1];
+
+    /**
+     * @brief isInline - returns true if the characters are stored in buffer
+     * @return true if data points at buffer
+     */
+    bool isInline() const;
+
+    /**
+     * @brief reserve - makes room for at least the given number of characters, keeping the current ones
+     * @param needed - number of characters, not counting the terminator
+     */
+    void reserve(const int needed);
+
+    /**
+     * @brief assign - replaces the characters of the string
+     * @param characters - characters to copy, need not be null terminated
+     * @param count - number of characters to copy
+     */
+    void assign(const char* characters, const int count);
+
+    /**
+     * @brief append - adds characters to the end of the string
+     * @param characters - characters to copy, need not be null terminated
+     * @param count - number of characters to copy
+     */
+    void append(const char* characters, const int count);
 };
 
 #endif // DSSTRING_H
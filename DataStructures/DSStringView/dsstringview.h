@@ -0,0 +1,325 @@
+#ifndef DSSTRINGVIEW_H
+#define DSSTRINGVIEW_H
+
+#include <climits>
+#include <cstring>
+#include <iostream>
+
+#include "../DSString/dsstring.h"
+
+/**
+ * @brief The DSStringView class - characters owned by someone else, given by a pointer and a length
+ *
+ * A view is never null terminated and never allocates, so fields can be cut out of a mapped file or a DSString
+ * and compared, hashed and parsed in place. The characters must outlive the view.
+ */
+class DSStringView
+{
+public:
+    /**
+     * @brief DSStringView - default constructor, creates an empty view
+     */
+    DSStringView() : characters(""), length(0) {}
+
+    /**
+     * @brief DSStringView - constructor
+     * @param data - null terminated characters to view
+     */
+    DSStringView(const char* data) : characters(data), length(int(std::strlen(data))) {}
+
+    /**
+     * @brief DSStringView - constructor
+     * @param data - characters to view, need not be null terminated
+     * @param length - number of characters
+     */
+    DSStringView(const char* data, const int length) : characters(data), length(length) {}
+
+    /**
+     * @brief DSStringView - constructor, views the characters of a string
+     * @param string - string to view, must not change while the view is used
+     */
+    DSStringView(const DSString& string) : characters(string.c_str()), length(string.size()) {}
+
+    /**
+     * @brief data - returns the first character
+     * @return pointer to the characters, not null terminated
+     */
+    const char* data() const{
+        return characters;
+    }
+
+    /**
+     * @brief size - returns the number of characters
+     * @return number of characters
+     */
+    int size() const{
+        return length;
+    }
+
+    /**
+     * @brief empty - returns true if the view has no characters
+     * @return true if size() is 0
+     */
+    bool empty() const{
+        return length == 0;
+    }
+
+    /**
+     * @brief operator [] - returns the character at the given index
+     * @param index - index of the character
+     * @return character at index
+     */
+    char operator[](const int index) const{
+        return characters[index];
+    }
+
+    /**
+     * @brief substring - returns the characters from start, clamped to the view
+     * @param start - index of the first character
+     * @param count - number of characters
+     * @return view of the characters
+     */
+    DSStringView substring(int start, int count) const{
+        if(start < 0){
+            start = 0;
+        }
+        if(start > length){
+            start = length;
+        }
+        if(count < 0 || count > length - start){
+            count = length - start;
+        }
+
+        return DSStringView(characters + start, count);
+    }
+
+    /**
+     * @brief findChar - finds a character at or after the given index
+     * @param searchChar - character to find
+     * @param from - index to start searching at
+     * @return index of the character, -1 if it is not found
+     */
+    int findChar(const char searchChar, const int from = 0) const{
+        if(from >= length){
+            return -1;
+        }
+
+        const char* found = static_cast<const char*>(std::memchr(characters + from, searchChar, length - from));
+        return found == nullptr ? -1 : int(found - characters);
+    }
+
+    /**
+     * @brief trim - returns the view without leading and trailing spaces, tabs, carriage returns and newlines
+     * @return view of the trimmed characters
+     */
+    DSStringView trim() const{
+        int start = 0;
+        int end = length;
+        while(start < end && isSpace(characters[start])){
+            start++;
+        }
+        while(end > start && isSpace(characters[end - 1])){
+            end--;
+        }
+
+        return DSStringView(characters + start, end - start);
+    }
+
+    /**
+     * @brief nextLine - removes the first line from the front of the view
+     * @param line - set to the line, without its newline
+     * @return false if the view was empty
+     */
+    bool nextLine(DSStringView& line){
+        if(length == 0){
+            return false;
+        }
+
+        int newline = findChar('\n');
+        int lineLength = newline == -1 ? length : newline;
+        int consumed = newline == -1 ? length : newline + 1;
+
+        line = DSStringView(characters, lineLength);
+        characters += consumed;
+        length -= consumed;
+
+        return true;
+    }
+
+    /**
+     * @brief nextToken - removes the first whitespace separated token from the front of the view
+     * @param token - set to the token
+     * @return false if only whitespace was left
+     */
+    bool nextToken(DSStringView& token){
+        int start = 0;
+        while(start < length && isSpace(characters[start])){
+            start++;
+        }
+
+        int end = start;
+        while(end < length && !isSpace(characters[end])){
+            end++;
+        }
+
+        token = DSStringView(characters + start, end - start);
+        characters += end;
+        length -= end;
+
+        return end > start;
+    }
+
+    /**
+     * @brief split - splits the view into its whitespace separated tokens
+     * @param fields - set to the tokens
+     * @param maxFields - number of tokens to record, later tokens are ignored
+     * @return number of tokens recorded
+     */
+    int split(DSStringView* fields, const int maxFields) const{
+        DSStringView rest = *this;
+
+        int numFields = 0;
+        while(numFields < maxFields && rest.nextToken(fields[numFields])){
+            numFields++;
+        }
+
+        return numFields;
+    }
+
+    /**
+     * @brief toInt - reads a decimal integer with an optional sign, stopping at the first other character like atoi,
+     * values outside the range of an int are clamped to it like strtol
+     * @return value of the view, 0 if it does not start with a number
+     */
+    int toInt() const{
+        int value = 0;
+        bool fits = true;
+        readInt(value, fits);
+
+        return value;
+    }
+
+    /**
+     * @brief parseInt - reads the whole view as a decimal integer with an optional sign
+     * @param value - set to the number, clamped to the range of an int
+     * @return false if the view holds anything but a number or the number does not fit in an int
+     */
+    bool parseInt(int& value) const{
+        bool fits = true;
+        int end = readInt(value, fits);
+
+        return fits && end == length && end > 0 && characters[end - 1] >= '0' && characters[end - 1] <= '9';
+    }
+
+    /**
+     * @brief compare - orders two views by their characters, a prefix before the longer view
+     * @param other - view to compare to
+     * @return negative, 0 or positive as this view sorts before, equal to or after other
+     */
+    int compare(const DSStringView& other) const{
+        int common = length < other.length ? length : other.length;
+        int result = common == 0 ? 0 : std::memcmp(characters, other.characters, common);
+        if(result != 0){
+            return result;
+        }
+
+        return length - other.length;
+    }
+
+    /**
+     * @brief toString - copies the characters into a string
+     * @return string holding the characters
+     */
+    DSString toString() const{
+        return DSString(characters, length);
+    }
+
+    // Conversion operator - copies the characters into a string
+    explicit operator DSString() const{
+        return toString();
+    }
+
+    // Comparison operator - params: const DSStringView& other
+    bool operator==(const DSStringView& other) const{
+        return length == other.length && (length == 0 || std::memcmp(characters, other.characters, length) == 0);
+    }
+
+    // Comparison operator - params: const char* other
+    bool operator==(const char* other) const{
+        return *this == DSStringView(other);
+    }
+
+    // Comparison operator - params: const DSStringView& other
+    bool operator!=(const DSStringView& other) const{
+        return !(*this == other);
+    }
+
+    // Comparison operator - params: const char* other
+    bool operator!=(const char* other) const{
+        return !(*this == DSStringView(other));
+    }
+
+    // less than operator - params: const DSStringView& other
+    bool operator<(const DSStringView& other) const{
+        return compare(other) < 0;
+    }
+
+    friend std::ostream& operator<<(std::ostream& stream, const DSStringView& view){
+        return stream.write(view.characters, view.length);
+    }
+
+private:
+    const char* characters;
+    int length;
+
+    /**
+     * @brief readInt - reads a decimal integer with an optional sign from the front of the view
+     * @param value - set to the number, clamped to the range of an int, 0 if there are no digits
+     * @param fits - set to false if the number had to be clamped
+     * @return index of the first character after the number
+     */
+    int readInt(int& value, bool& fits) const{
+        int i = 0;
+        bool negative = false;
+        if(i < length && (characters[i] == '-' || characters[i] == '+')){
+            negative = characters[i] == '-';
+            i++;
+        }
+
+        // once past INT_MAX + 1 the number is out of range, so later digits are skipped and the sum cannot overflow
+        const long long limit = (long long)INT_MAX + 1;
+        long long magnitude = 0;
+        for(; i < length && characters[i] >= '0' && characters[i] <= '9'; i++){
+            if(magnitude < limit){
+                magnitude = magnitude * 10 + (characters[i] - '0');
+            }
+        }
+
+        long long signedValue = negative ? -magnitude : magnitude;
+        fits = signedValue >= INT_MIN && signedValue <= INT_MAX;
+        value = signedValue > INT_MAX ? INT_MAX : signedValue < INT_MIN ? INT_MIN : int(signedValue);
+
+        return i;
+    }
+
+    /**
+     * @brief isSpace - returns true for the characters that separate fields
+     * @param c - character to check
+     * @return true for spaces, tabs, carriage returns and newlines
+     */
+    static bool isSpace(const char c){
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+};
+
+// Comparison operator - params: const DSString& string, const DSStringView& view
+inline bool operator==(const DSString& string, const DSStringView& view){
+    return DSStringView(string) == view;
+}
+
+// Comparison operator - params: const DSStringView& view, const DSString& string
+inline bool operator==(const DSStringView& view, const DSString& string){
+    return view == DSStringView(string);
+}
+
+#endif // DSSTRINGVIEW_H
@@ -1,6 +1,11 @@
 #ifndef DSVECTOR_H
 #define DSVECTOR_H
 
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
 template <class T>
 class DSVector
 {
@@ -72,6 +77,9 @@ private:
         // constructor - params: DSVector<T>& other
         DSVector(const DSVector<T>& other);
 
+        // move constructor, takes other's storage and leaves it empty - params: DSVector<T>&& other
+        DSVector(DSVector<T>&& other) noexcept;
+
         // getter - numIndexes
         int getNumIndexes() const;
 
@@ -80,6 +88,9 @@ private:
         // getter - capacity
         int getCapacity() const;
 
+        // grows capacity to at least the passed in capacity, never shrinks - params: const int capacity
+        void reserve(const int capacity);
+
         // setter - resizeIncrement
         void setResizeIncrement(const int resizeIncrement);
         // getter - resizeIncrement
@@ -87,6 +98,12 @@ private:
 
         // adds element to back of data array - params: T newElement
         void pushBack(const T& newelement);
+        // moves element to back of data array - params: T&& newElement
+        void pushBack(T&& newElement);
+
+        // constructs an element in place at the back of data array and returns it - params: constructor arguments
+        template <class... Args>
+        T& emplaceBack(Args&&... args);
 
         // removes last element of data array
         void removeLast();
@@ -94,7 +111,7 @@ private:
         // creates new vector with capacity equal to numIndexes
         void shrink();
 
-        // deletes data and creates an empty array in its place
+        // destroys every element, the capacity is kept
         void clear();
 
         // returns the first element of data array
@@ -110,6 +127,9 @@ private:
         // sets this to the passed in vector - params: const DSVector<T>& other
         DSVector<T>& operator=(const DSVector<T>& other);
 
+        // takes the passed in vector's storage and leaves it empty - params: DSVector<T>&& other
+        DSVector<T>& operator=(DSVector<T>&& other) noexcept;
+
         // adds then returns passed in vector to the end of this - params: const DSVector<T>& other
         DSVector<T>& operator+=(const DSVector<T>& other);
         // adds then returns passed in element to the end of this - params: const T& element
@@ -145,34 +165,66 @@ private:
         }
 
     private:
+        // storage is allocated raw, only the first numIndexes slots hold constructed elements
         T* data;
         int capacity;
         int numIndexes;
+        // smallest number of slots added when the vector grows
         int resizeIncrement;
+
+        // returns raw storage for the passed in number of elements - params: const int capacity
+        static T* allocate(const int capacity);
+
+        // moves count elements from source into raw storage at dest and destroys them in source
+        // params: T* source, const int count, T* dest
+        static void relocate(T* source, const int count, T* dest);
+
+        // destroys the elements from index first to numIndexes - params: const int first
+        void destroyFrom(const int first);
+
+        // moves the elements into new storage of the passed in capacity - params: const int capacity
+        void reallocate(const int capacity);
+
+        // returns the capacity to grow to for at least the passed in number of elements - params: const int needed
+        int grownCapacity(const int needed) const;
 };
 
 // default constructor - params: int resizeIncrement = 5
+// no storage is allocated until the first element is added
 template <class T>
 DSVector<T>::DSVector(int resizeIncrement){
-    this->resizeIncrement = resizeIncrement;
+    this->resizeIncrement = resizeIncrement > 0 ? resizeIncrement : 1;
     numIndexes = 0;
-    capacity = this->resizeIncrement;
-    data = new T[capacity];
+    capacity = 0;
+    data = nullptr;
 }
 
 // constructor - params: DSVector<T>& other
 template <class T>
 DSVector<T>::DSVector(const DSVector<T>& other){
-    numIndexes = other.numIndexes;
-    capacity = other.capacity;
+    numIndexes = 0;
+    capacity = other.numIndexes;
     resizeIncrement = other.resizeIncrement;
-    data = new T[capacity];
+    data = capacity > 0 ? allocate(capacity) : nullptr;
 
-    for(int i = 0; i < numIndexes; i++){
-        this->data[i] = other.data[i];
+    for(; numIndexes < other.numIndexes; numIndexes++){
+        new (data + numIndexes) T(other.data[numIndexes]);
     }
 }
 
+// move constructor, takes other's storage and leaves it empty - params: DSVector<T>&& other
+template <class T>
+DSVector<T>::DSVector(DSVector<T>&& other) noexcept{
+    data = other.data;
+    capacity = other.capacity;
+    numIndexes = other.numIndexes;
+    resizeIncrement = other.resizeIncrement;
+
+    other.data = nullptr;
+    other.capacity = 0;
+    other.numIndexes = 0;
+}
+
 // getter - numIndexes
 template <class T>
 int DSVector<T>::getNumIndexes() const{
@@ -182,7 +234,7 @@ int DSVector<T>::getNumIndexes() const{
 // setter - resizeIncrement (no data change till resize occurs)
 template <class T>
 void DSVector<T>::setResizeIncrement(const int resizeIncrement){
-    this->resizeIncrement = resizeIncrement;
+    this->resizeIncrement = resizeIncrement > 0 ? resizeIncrement : 1;
 }
 
 // getter - resizeIncrement
@@ -197,28 +249,18 @@ int DSVector<T>::getCapacity() const{
     return capacity;
 }
 
-// setter - capacity
+// setter - capacity, never below numIndexes
 template <class T>
 void DSVector<T>::setCapacity(const int capacity){
-    if(this->capacity == capacity){
-        return;
-    }
-
-    if(capacity <= numIndexes){
-        this->capacity = numIndexes;
-    } else {
-        this->capacity = capacity;
-    }
-
-    T* tempArray = new T[this->capacity];
+    reallocate(capacity <= numIndexes ? numIndexes : capacity);
+}
 
-    for(int i = 0; i < numIndexes; i++){
-        tempArray[i] = data[i];
+// grows capacity to at least the passed in capacity, never shrinks - params: const int capacity
+template <class T>
+void DSVector<T>::reserve(const int capacity){
+    if(capacity > this->capacity){
+        reallocate(capacity);
     }
-
-    delete[] data;
-
-    data = tempArray;
 }
 
 // creates new vector with capacity equal to numIndexes
@@ -230,39 +272,48 @@ void DSVector<T>::shrink(){
 // adds element to back of data array - params: T newElement
 template <class T>
 void DSVector<T>::pushBack(const T& newElement){
-    // expand data if needed
-    if(numIndexes == capacity){
-        capacity = numIndexes + resizeIncrement - (numIndexes % resizeIncrement);
+    emplaceBack(newElement);
+}
 
-        T* tempArray = new T[capacity];
+// moves element to back of data array - params: T&& newElement
+template <class T>
+void DSVector<T>::pushBack(T&& newElement){
+    emplaceBack(std::move(newElement));
+}
 
-        for(int i = 0; i < numIndexes; i++){
-            tempArray[i] = data[i];
-        }
+// constructs an element in place at the back of data array and returns it - params: constructor arguments
+// when full the element is constructed in the new storage before the old elements move, so arguments may refer
+// to elements of this vector
+template <class T>
+template <class... Args>
+T& DSVector<T>::emplaceBack(Args&&... args){
+    if(numIndexes == capacity){
+        int newCapacity = grownCapacity(numIndexes + 1);
+        T* tempArray = allocate(newCapacity);
 
-        delete[] data;
+        new (tempArray + numIndexes) T(std::forward<Args>(args)...);
+        relocate(data, numIndexes, tempArray);
+        ::operator delete(data);
 
         data = tempArray;
+        capacity = newCapacity;
+    } else {
+        new (data + numIndexes) T(std::forward<Args>(args)...);
     }
 
-    data[numIndexes++] = newElement;
-
+    return data[numIndexes++];
 }
 
 // removes last element of data array
 template <class T>
 void DSVector<T>::removeLast(){
-    numIndexes--;
+    destroyFrom(numIndexes - 1);
 }
 
-// deletes data and creates an empty array in its place
+// destroys every element, the capacity is kept
 template <class T>
 void DSVector<T>::clear(){
-    delete[] data;
-
-    numIndexes = 0;
-
-    data = new T[capacity];
+    destroyFrom(0);
 }
 
 // returns the first element of data array
@@ -284,48 +335,67 @@ T* DSVector<T>::getData() const{
 }
 
 // sets this to the passed in vector - params: const DSVector<T>& other
+// the storage is reused when it can hold every element of other
 template <class T>
 DSVector<T>& DSVector<T>::operator=(const DSVector<T>& other){
-    delete[] data;
+    if(this == &other){
+        return *this;
+    }
 
-    numIndexes = other.numIndexes;
-    capacity = other.capacity;
+    destroyFrom(0);
     resizeIncrement = other.resizeIncrement;
 
-    data = new T[capacity];
+    if(capacity < other.numIndexes){
+        ::operator delete(data);
+        data = allocate(other.numIndexes);
+        capacity = other.numIndexes;
+    }
 
-    for(int i = 0; i < numIndexes; i++){
-        data[i] = other.data[i];
+    for(; numIndexes < other.numIndexes; numIndexes++){
+        new (data + numIndexes) T(other.data[numIndexes]);
     }
 
     return *this;
 }
 
-// adds then returns passed in vector to the end of this - params: const DSVector<T>& other
+// takes the passed in vector's storage and leaves it empty - params: DSVector<T>&& other
 template <class T>
-DSVector<T>& DSVector<T>::operator+=(const DSVector<T>& other){
-    int oldSize = numIndexes;
-    numIndexes += other.numIndexes;
+DSVector<T>& DSVector<T>::operator=(DSVector<T>&& other) noexcept{
+    if(this == &other){
+        return *this;
+    }
 
-    // keep capacity as a multiple of the resizeIncrement
-    int newCap = numIndexes + resizeIncrement - (numIndexes % resizeIncrement);
+    destroyFrom(0);
+    ::operator delete(data);
 
-    if(capacity < newCap){
-        capacity = newCap;
+    data = other.data;
+    capacity = other.capacity;
+    numIndexes = other.numIndexes;
+    resizeIncrement = other.resizeIncrement;
 
-        T* tempArray = new T[newCap];
+    other.data = nullptr;
+    other.capacity = 0;
+    other.numIndexes = 0;
 
-        for(int i = 0; i < oldSize; i++){
-            tempArray[i] = data[i];
-        }
+    return *this;
+}
 
-    delete[] data;
+// adds then returns passed in vector to the end of this - params: const DSVector<T>& other
+template <class T>
+DSVector<T>& DSVector<T>::operator+=(const DSVector<T>& other){
+    // growing would free the elements being copied
+    if(this == &other){
+        DSVector<T> copy(other);
+        return *this += copy;
+    }
 
-        data = tempArray;
+    if(numIndexes + other.numIndexes > capacity){
+        reallocate(grownCapacity(numIndexes + other.numIndexes));
     }
 
-    for(int i = oldSize; i < numIndexes; i++){
-        data[i] = other.data[i - oldSize];
+    for(int i = 0; i < other.numIndexes; i++){
+        new (data + numIndexes) T(other.data[i]);
+        numIndexes++;
     }
 
     return *this;
@@ -334,20 +404,7 @@ DSVector<T>& DSVector<T>::operator+=(const DSVector<T>& other){
 // adds then returns passed in element to the end of this - params: const T& element
 template <class T>
 DSVector<T>& DSVector<T>::operator+=(const T& element){
-    if(capacity == numIndexes){
-        capacity += resizeIncrement;
-        
-        T* tempArray = new T[capacity];
-        
-        for(int i = 0; i < numIndexes; i++){
-            tempArray[i] = data[i];
-        }
-        delete[] data;
-
-        data = tempArray;
-    }
-
-    data[numIndexes++] = element;
+    emplaceBack(element);
 
     return *this;
 }
@@ -355,7 +412,10 @@ DSVector<T>& DSVector<T>::operator+=(const T& element){
 // returns this vector added to the passed in vector - params: const DSVector<T>& other
 template <class T>
 DSVector<T> DSVector<T>::operator+(const DSVector<T>& other) const{
-    DSVector<T> result = *this;
+    DSVector<T> result;
+    result.resizeIncrement = resizeIncrement;
+    result.reserve(numIndexes + other.numIndexes);
+    result += *this;
     result += other;
     return result;
 }
@@ -363,7 +423,10 @@ DSVector<T> DSVector<T>::operator+(const DSVector<T>& other) const{
 // returns this vector added to the passed in element - params: const T& element
 template <class T>
 DSVector<T> DSVector<T>::operator+(const T& element) const{
-    DSVector<T> result = *this;
+    DSVector<T> result;
+    result.resizeIncrement = resizeIncrement;
+    result.reserve(numIndexes + 1);
+    result += *this;
     result += element;
     return result;
 }
@@ -399,7 +462,77 @@ T DSVector<T>::operator[](const int index) const{
 // default destructor
 template<class T>
 DSVector<T>::~DSVector(){
-    delete[] data;
+    destroyFrom(0);
+    ::operator delete(data);
+}
+
+// returns raw storage for the passed in number of elements - params: const int capacity
+template <class T>
+T* DSVector<T>::allocate(const int capacity){
+    return static_cast<T*>(::operator new(sizeof(T) * capacity));
+}
+
+// moves count elements from source into raw storage at dest and destroys them in source
+// trivially copyable elements are copied as bytes, anything else is move constructed
+// params: T* source, const int count, T* dest
+template <class T>
+void DSVector<T>::relocate(T* source, const int count, T* dest){
+    if(count == 0){
+        return;
+    }
+
+    if(std::is_trivially_copyable<T>::value){
+        std::memcpy(static_cast<void*>(dest), static_cast<const void*>(source), sizeof(T) * count);
+        return;
+    }
+
+    for(int i = 0; i < count; i++){
+        new (dest + i) T(std::move(source[i]));
+        source[i].~T();
+    }
+}
+
+// destroys the elements from index first to numIndexes - params: const int first
+template <class T>
+void DSVector<T>::destroyFrom(const int first){
+    if(!std::is_trivially_destructible<T>::value){
+        for(int i = first; i < numIndexes; i++){
+            data[i].~T();
+        }
+    }
+
+    numIndexes = first;
+}
+
+// moves the elements into new storage of the passed in capacity - params: const int capacity
+template <class T>
+void DSVector<T>::reallocate(const int capacity){
+    if(this->capacity == capacity){
+        return;
+    }
+
+    T* tempArray = capacity > 0 ? allocate(capacity) : nullptr;
+
+    // a capacity of 0 only follows an empty vector, so there is nothing to move
+    if(tempArray != nullptr){
+        relocate(data, numIndexes, tempArray);
+    }
+    ::operator delete(data);
+
+    data = tempArray;
+    this->capacity = capacity;
+}
+
+// returns the capacity to grow to for at least the passed in number of elements - params: const int needed
+// doubling keeps appending n elements O(n), resizeIncrement only sets the smallest step
+template <class T>
+int DSVector<T>::grownCapacity(const int needed) const{
+    int grown = capacity * 2;
+    if(grown < capacity + resizeIncrement){
+        grown = capacity + resizeIncrement;
+    }
+
+    return grown > needed ? grown : needed;
 }
 
 #endif // DSVECTOR_H
@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "benchoptions.h"
+#include "flightplanner.h"
+#include "networkgenerator.h"
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * @brief elapsed - returns the time since a start point
+ * @param start - start point
+ * @return seconds since start
+ */
+double elapsed(const Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/**
+ * @brief writeSummary - writes the distribution of a set of samples as a JSON object
+ * @param out - stream to write to
+ * @param samples - samples to summarise, sorted in place
+ * @param scale - factor applied to every sample, such as 1000 for seconds to milliseconds
+ */
+void writeSummary(std::ostream& out, std::vector<double>& samples, const double scale)
+{
+    if(samples.empty()){
+        out << "{\"count\": 0}";
+        return;
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    double total = 0;
+    for(double sample : samples){
+        total += sample;
+    }
+
+    auto percentile = [&](const double p){
+        size_t index = static_cast<size_t>(p * (samples.size() - 1) + 0.5);
+        return samples[index] * scale;
+    };
+
+    out << "{\"count\": " << samples.size()
+        << ", \"min\": " << samples.front() * scale
+        << ", \"mean\": " << total / samples.size() * scale
+        << ", \"p50\": " << percentile(0.50)
+        << ", \"p90\": " << percentile(0.90)
+        << ", \"p99\": " << percentile(0.99)
+        << ", \"max\": " << samples.back() * scale << "}";
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    NetworkGenerator::Options options;
+    int numQueries = 200;
+    int numBatch = 1000;
+    int repeat = 5;
+    int numThreads = 1;
+    std::string outputPath;
+    std::string workDir = "/tmp";
+
+    int arg = 1;
+    while(arg < argc){
+        if(parseNetworkOption(argc, argv, arg, options)){
+            continue;
+        }
+
+        if(arg + 1 >= argc){
+            std::cerr << "Unknown option: " << argv[arg] << std::endl;
+            return 1;
+        }
+
+        if(std::strcmp(argv[arg], "--queries") == 0){
+            numQueries = std::atoi(argv[arg + 1]);
+        } else if(std::strcmp(argv[arg], "--batch") == 0){
+            numBatch = std::atoi(argv[arg + 1]);
+        } else if(std::strcmp(argv[arg], "--repeat") == 0){
+            repeat = std::max(1, std::atoi(argv[arg + 1]));
+        } else if(std::strcmp(argv[arg], "--threads") == 0){
+            numThreads = std::atoi(argv[arg + 1]);
+        } else if(std::strcmp(argv[arg], "--output") == 0){
+            outputPath = argv[arg + 1];
+        } else if(std::strcmp(argv[arg], "--workdir") == 0){
+            workDir = argv[arg + 1];
+        } else {
+            std::cerr << "Unknown option: " << argv[arg] << "\n"
+                      << "Usage: flightplanner_bench " NETWORK_OPTIONS_USAGE
+                         " [--queries N] [--batch N] [--repeat N] [--threads N] [--workdir dir] [--output file.json]" << std::endl;
+            return 1;
+        }
+
+        arg += 2;
+    }
+
+    // the planner reads files, so the network is generated into the work directory first
+    std::string prefix = workDir + "/flightplanner_bench_" + std::to_string(getpid());
+    std::string dataPath = prefix + "_data.txt";
+    std::string plansPath = prefix + "_plans.txt";
+    std::string networkPath = prefix + "_network.bin";
+    std::string outputFilePath = prefix + "_output.txt";
+
+    NetworkGenerator generator(options);
+    if(!generator.writeFlights(dataPath.c_str()) || !generator.writeRequests(plansPath.c_str(), numBatch)){
+        std::cerr << "Could not write benchmark input to " << workDir << std::endl;
+        return 1;
+    }
+
+    // graph build from text and from a compiled network
+    std::vector<double> textBuild;
+    std::vector<double> compiledLoad;
+    for(int i = 0; i < repeat; i++){
+        FlightPlanner planner;
+
+        Clock::time_point start = Clock::now();
+        planner.createFlightList(dataPath.c_str());
+        textBuild.push_back(elapsed(start));
+
+        if(i == 0){
+            planner.compileNetwork(networkPath.c_str());
+        }
+
+        FlightPlanner loaded;
+        start = Clock::now();
+        loaded.loadNetwork(networkPath.c_str());
+        compiledLoad.push_back(elapsed(start));
+    }
+
+    FlightPlanner planner;
+    planner.createFlightList(dataPath.c_str());
+    planner.setThreadCount(numThreads);
+    // every query and batch is searched, not answered from earlier runs
+    planner.setCacheSize(0);
+
+    // single query latency, both objectives on the same routes
+    std::vector<double> timeQueries;
+    std::vector<double> costQueries;
+    FlightPlanner::RouteSearch search = planner.createSearch();
+    for(int i = 0; i < numQueries; i++){
+        int origin;
+        int dest;
+        generator.randomRoute(origin, dest);
+
+        DSString originName = NetworkGenerator::airportName(origin);
+        DSString destName = NetworkGenerator::airportName(dest);
+
+        Clock::time_point start = Clock::now();
+        planner.planRoute(originName, destName, 'T', search);
+        timeQueries.push_back(elapsed(start));
+
+        start = Clock::now();
+        planner.planRoute(originName, destName, 'C', search);
+        costQueries.push_back(elapsed(start));
+    }
+
+    // batch throughput of planFlights, reading requests and writing plans included
+    std::vector<double> batch;
+    for(int i = 0; i < repeat; i++){
+        Clock::time_point start = Clock::now();
+        planner.planFlights(plansPath.c_str(), outputFilePath.c_str());
+        batch.push_back(elapsed(start));
+    }
+
+    std::vector<double> throughput;
+    for(double seconds : batch){
+        throughput.push_back(seconds > 0 ? numBatch / seconds : 0);
+    }
+
+    std::ostringstream json;
+    json << "{\n"
+         << "  \"benchmark\": \"flightplanner\",\n"
+         << "  \"format\": 1,\n"
+         << "  \"config\": {\"airports\": " << options.airports << ", \"flights\": " << options.flights
+         << ", \"airlines\": " << options.airlines << ", \"hubs\": " << options.hubs << ", \"skew\": " << options.skew
+         << ", \"hub_share\": " << options.hubShare << ", \"seed\": " << options.seed << ", \"queries\": " << numQueries
+         << ", \"batch\": " << numBatch << ", \"repeat\": " << repeat << ", \"threads\": " << numThreads << "},\n"
+         << "  \"build_text_ms\": ";
+    writeSummary(json, textBuild, 1e3);
+    json << ",\n  \"build_compiled_ms\": ";
+    writeSummary(json, compiledLoad, 1e3);
+    json << ",\n  \"query_time_us\": ";
+    writeSummary(json, timeQueries, 1e6);
+    json << ",\n  \"query_cost_us\": ";
+    writeSummary(json, costQueries, 1e6);
+    json << ",\n  \"batch_s\": ";
+    writeSummary(json, batch, 1);
+    json << ",\n  \"batch_requests_per_s\": ";
+    writeSummary(json, throughput, 1);
+    json << "\n}\n";
+
+    std::remove(dataPath.c_str());
+    std::remove(plansPath.c_str());
+    std::remove(networkPath.c_str());
+    std::remove(outputFilePath.c_str());
+
+    if(outputPath.empty()){
+        std::cout << json.str();
+    } else {
+        std::ofstream file(outputPath);
+        file << json.str();
+        if(file.fail()){
+            std::cerr << "Could not write results: " << outputPath << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,50 @@
+#ifndef BENCHOPTIONS_H
+#define BENCHOPTIONS_H
+
+#include <cstdlib>
+#include <cstring>
+
+#include "networkgenerator.h"
+
+/**
+ * @brief parseNetworkOption - reads one generator option and its value from the command line
+ * @param argc - number of arguments
+ * @param argv - arguments
+ * @param arg - index of the option, moved past the option and its value when it is recognised
+ * @param options - generator options to set
+ * @return true if the option was a generator option
+ */
+inline bool parseNetworkOption(const int argc, char* argv[], int& arg, NetworkGenerator::Options& options)
+{
+    if(arg + 1 >= argc){
+        return false;
+    }
+
+    const char* name = argv[arg];
+    const char* value = argv[arg + 1];
+
+    if(std::strcmp(name, "--airports") == 0){
+        options.airports = std::atoi(value);
+    } else if(std::strcmp(name, "--flights") == 0){
+        options.flights = std::atoi(value);
+    } else if(std::strcmp(name, "--airlines") == 0){
+        options.airlines = std::atoi(value);
+    } else if(std::strcmp(name, "--hubs") == 0){
+        options.hubs = std::atoi(value);
+    } else if(std::strcmp(name, "--skew") == 0){
+        options.skew = std::atof(value);
+    } else if(std::strcmp(name, "--hub-share") == 0){
+        options.hubShare = std::atof(value);
+    } else if(std::strcmp(name, "--seed") == 0){
+        options.seed = static_cast<unsigned int>(std::strtoul(value, nullptr, 10));
+    } else {
+        return false;
+    }
+
+    arg += 2;
+    return true;
+}
+
+#define NETWORK_OPTIONS_USAGE "[--airports N] [--flights N] [--airlines N] [--hubs N] [--skew S] [--hub-share S] [--seed N]"
+
+#endif // BENCHOPTIONS_H
@@ -0,0 +1,824 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <new>
+#include <queue>
+#include <sstream>
+#include <stack>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "DataStructures/DSDoublyLL/dsdoublyll.h"
+#include "DataStructures/DSHashMap/dshashmap.h"
+#include "DataStructures/DSPriorityQueue/dspriorityqueue.h"
+#include "DataStructures/DSStack/dsstack.h"
+#include "DataStructures/DSString/dsstring.h"
+#include "DataStructures/DSStringView/dsstringview.h"
+#include "DataStructures/DSVector/dsvector.h"
+
+// every allocation in the process goes through these counters, so DS containers and std containers are measured
+// the same way without either having to take an allocator
+static size_t allocationCount = 0;
+static size_t allocationBytes = 0;
+
+/**
+ * @brief acquire - counts an allocation and takes its memory from malloc
+ * @param bytes - size of the allocation
+ * @return memory of at least bytes, never nullptr
+ */
+static void* acquire(const size_t bytes)
+{
+    allocationCount++;
+    allocationBytes += bytes;
+
+    void* memory = std::malloc(bytes == 0 ? 1 : bytes);
+    if(memory == nullptr){
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+/**
+ * @brief release - returns memory taken by acquire to malloc, every delete goes through here so the replaced
+ * operators stay paired with malloc and free
+ * @param memory - memory from acquire, may be nullptr
+ */
+static void release(void* memory)
+{
+    std::free(memory);
+}
+
+void* operator new(size_t bytes)
+{
+    return acquire(bytes);
+}
+
+void* operator new[](size_t bytes)
+{
+    return acquire(bytes);
+}
+
+void operator delete(void* memory) noexcept
+{
+    release(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    release(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    release(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept
+{
+    release(memory);
+}
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+// results are folded into this so the measured loops cannot be optimised away
+volatile long long sink = 0;
+
+/**
+ * @brief The Result struct - one operation measured on one container
+ */
+struct Result{
+    std::string family;
+    std::string container;
+    std::string operation;
+    long long elements;
+    double nsPerElement;
+    double allocationsPerRun;
+    double bytesPerRun;
+};
+
+std::vector<Result> results;
+int repeat = 5;
+
+/**
+ * @brief measure - runs an operation repeat times and records the fastest run and its allocations
+ * @param family - container family, such as vector, shared by a DS container and its std baseline
+ * @param container - name of the container
+ * @param operation - name of the operation
+ * @param elements - number of elements the operation touches per run, used to scale the time
+ * @param run - operation to measure, returns a value folded into the sink
+ */
+template <class Run>
+void measure(const char* family, const char* container, const char* operation, const long long elements, Run run)
+{
+    double best = 0;
+    size_t allocations = 0;
+    size_t bytes = 0;
+
+    for(int i = 0; i < repeat; i++){
+        size_t startCount = allocationCount;
+        size_t startBytes = allocationBytes;
+        Clock::time_point start = Clock::now();
+
+        sink += run();
+
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        if(i == 0 || seconds < best){
+            best = seconds;
+        }
+        allocations = allocationCount - startCount;
+        bytes = allocationBytes - startBytes;
+    }
+
+    results.push_back({family, container, operation, elements, best * 1e9 / elements, double(allocations), double(bytes)});
+}
+
+/**
+ * @brief benchVectors - push, indexed access, iteration, copy, concatenation and search for DSVector and std::vector
+ * @param n - number of elements
+ */
+void benchVectors(const int n)
+{
+    measure("vector", "DSVector", "push", n, [&](){
+        DSVector<int> v;
+        for(int i = 0; i < n; i++){
+            v.pushBack(i);
+        }
+        return (long long)v.getNumIndexes();
+    });
+    measure("vector", "std::vector", "push", n, [&](){
+        std::vector<int> v;
+        for(int i = 0; i < n; i++){
+            v.push_back(i);
+        }
+        return (long long)v.size();
+    });
+
+    DSVector<int> ds;
+    std::vector<int> st;
+    for(int i = 0; i < n; i++){
+        ds.pushBack(i);
+        st.push_back(i);
+    }
+
+    measure("vector", "DSVector", "index", n, [&](){
+        long long sum = 0;
+        for(int i = 0; i < n; i++){
+            sum += ds[i];
+        }
+        return sum;
+    });
+    measure("vector", "std::vector", "index", n, [&](){
+        long long sum = 0;
+        for(int i = 0; i < n; i++){
+            sum += st[i];
+        }
+        return sum;
+    });
+
+    measure("vector", "DSVector", "iterate", n, [&](){
+        long long sum = 0;
+        for(int value : ds){
+            sum += value;
+        }
+        return sum;
+    });
+    measure("vector", "std::vector", "iterate", n, [&](){
+        long long sum = 0;
+        for(int value : st){
+            sum += value;
+        }
+        return sum;
+    });
+
+    measure("vector", "DSVector", "copy", n, [&](){
+        DSVector<int> copy = ds;
+        return (long long)copy.getNumIndexes();
+    });
+    measure("vector", "std::vector", "copy", n, [&](){
+        std::vector<int> copy = st;
+        return (long long)copy.size();
+    });
+
+    measure("vector", "DSVector", "concat", 2LL * n, [&](){
+        DSVector<int> joined = ds;
+        joined += ds;
+        return (long long)joined.getNumIndexes();
+    });
+    measure("vector", "std::vector", "concat", 2LL * n, [&](){
+        std::vector<int> joined = st;
+        joined.insert(joined.end(), st.begin(), st.end());
+        return (long long)joined.size();
+    });
+
+    // DSVector has no search of its own, so both scan for a missing value by hand over their raw arrays
+    measure("vector", "DSVector", "search", n, [&](){
+        const int* data = ds.getData();
+        for(int i = 0; i < ds.getNumIndexes(); i++){
+            if(data[i] == -1){
+                return 1LL;
+            }
+        }
+        return 0LL;
+    });
+    measure("vector", "std::vector", "search", n, [&](){
+        return (long long)(std::find(st.begin(), st.end(), -1) != st.end());
+    });
+}
+
+/**
+ * @brief benchLists - push, indexed access, index loops, iteration, copy, concatenation and search for DSDoublyLL and
+ * std::list
+ * @param n - number of elements
+ * @param lookups - number of indexed lookups, kept small since both lists walk to the index
+ */
+void benchLists(const int n, const int lookups)
+{
+    measure("list", "DSDoublyLL", "push", n, [&](){
+        DSDoublyLL<int> l;
+        for(int i = 0; i < n; i++){
+            l.pushBack(i);
+        }
+        return (long long)l.size();
+    });
+    measure("list", "std::list", "push", n, [&](){
+        std::list<int> l;
+        for(int i = 0; i < n; i++){
+            l.push_back(i);
+        }
+        return (long long)l.size();
+    });
+
+    DSDoublyLL<int> ds;
+    std::list<int> st;
+    for(int i = 0; i < n; i++){
+        ds.pushBack(i);
+        st.push_back(i);
+    }
+
+    measure("list", "DSDoublyLL", "index", lookups, [&](){
+        long long sum = 0;
+        for(int i = 0; i < lookups; i++){
+            sum += ds[(i * 7919LL) % n];
+        }
+        return sum;
+    });
+    measure("list", "std::list", "index", lookups, [&](){
+        long long sum = 0;
+        for(int i = 0; i < lookups; i++){
+            sum += *std::next(st.begin(), (i * 7919LL) % n);
+        }
+        return sum;
+    });
+
+    measure("list", "DSDoublyLL", "scan", n, [&](){
+        long long sum = 0;
+        for(int i = 0; i < n; i++){
+            sum += ds[i];
+        }
+        return sum;
+    });
+    measure("list", "std::list", "scan", n, [&](){
+        // std::list has no indexing, so the baseline is the iterator walk an index loop stands in for
+        long long sum = 0;
+        for(std::list<int>::iterator i = st.begin(); i != st.end(); ++i){
+            sum += *i;
+        }
+        return sum;
+    });
+
+    measure("list", "DSDoublyLL", "iterate", n, [&](){
+        long long sum = 0;
+        for(int value : ds){
+            sum += value;
+        }
+        return sum;
+    });
+    measure("list", "std::list", "iterate", n, [&](){
+        long long sum = 0;
+        for(int value : st){
+            sum += value;
+        }
+        return sum;
+    });
+
+    measure("list", "DSDoublyLL", "copy", n, [&](){
+        DSDoublyLL<int> copy = ds;
+        return (long long)copy.size();
+    });
+    measure("list", "std::list", "copy", n, [&](){
+        std::list<int> copy = st;
+        return (long long)copy.size();
+    });
+
+    measure("list", "DSDoublyLL", "concat", 2LL * n, [&](){
+        DSDoublyLL<int> joined = ds;
+        joined += ds;
+        return (long long)joined.size();
+    });
+    measure("list", "std::list", "concat", 2LL * n, [&](){
+        std::list<int> joined = st;
+        joined.insert(joined.end(), st.begin(), st.end());
+        return (long long)joined.size();
+    });
+
+    measure("list", "DSDoublyLL", "search", n, [&](){
+        return (long long)ds.contains(-1);
+    });
+    measure("list", "std::list", "search", n, [&](){
+        return (long long)(std::find(st.begin(), st.end(), -1) != st.end());
+    });
+}
+
+/**
+ * @brief benchStacks - push, peek, pop, copy and concatenation for DSStack and a std::stack over std::vector
+ * @param n - number of elements
+ */
+void benchStacks(const int n)
+{
+    measure("stack", "DSStack", "push", n, [&](){
+        DSStack<int> s;
+        for(int i = 0; i < n; i++){
+            s.push(i);
+        }
+        return (long long)s.size();
+    });
+    measure("stack", "std::stack", "push", n, [&](){
+        std::stack<int, std::vector<int>> s;
+        for(int i = 0; i < n; i++){
+            s.push(i);
+        }
+        return (long long)s.size();
+    });
+
+    DSStack<int> ds;
+    std::stack<int, std::vector<int>> st;
+    for(int i = 0; i < n; i++){
+        ds.push(i);
+        st.push(i);
+    }
+
+    measure("stack", "DSStack", "peek", n, [&](){
+        long long sum = 0;
+        for(int i = 0; i < n; i++){
+            sum += ds.peek();
+        }
+        return sum;
+    });
+    measure("stack", "std::stack", "peek", n, [&](){
+        long long sum = 0;
+        for(int i = 0; i < n; i++){
+            sum += st.top();
+        }
+        return sum;
+    });
+
+    measure("stack", "DSStack", "pop", n, [&](){
+        DSStack<int> copy = ds;
+        long long sum = 0;
+        while(copy.size() > 0){
+            sum += copy.peek();
+            copy.pop();
+        }
+        return sum;
+    });
+    measure("stack", "std::stack", "pop", n, [&](){
+        std::stack<int, std::vector<int>> copy = st;
+        long long sum = 0;
+        while(!copy.empty()){
+            sum += copy.top();
+            copy.pop();
+        }
+        return sum;
+    });
+
+    measure("stack", "DSStack", "copy", n, [&](){
+        DSStack<int> copy = ds;
+        return (long long)copy.size();
+    });
+    measure("stack", "std::stack", "copy", n, [&](){
+        std::stack<int, std::vector<int>> copy = st;
+        return (long long)copy.size();
+    });
+
+    measure("stack", "DSStack", "concat", 2LL * n, [&](){
+        DSStack<int> joined = ds;
+        joined += ds;
+        return (long long)joined.size();
+    });
+    measure("stack", "std::stack", "concat", 2LL * n, [&](){
+        // std::stack cannot append another stack, so the copy pushes the same values DSStack appends
+        std::stack<int, std::vector<int>> joined = st;
+        for(int i = 0; i < n; i++){
+            joined.push(i);
+        }
+        return (long long)joined.size();
+    });
+}
+
+/**
+ * @brief benchStrings - append, indexed access, iteration, copy, concatenation and search for DSString and
+ * std::string
+ * @param n - number of characters
+ */
+void benchStrings(const int n)
+{
+    measure("string", "DSString", "append", n, [&](){
+        DSString s;
+        for(int i = 0; i < n; i++){
+            s += static_cast<char>('a' + i % 26);
+        }
+        return (long long)s.size();
+    });
+    measure("string", "std::string", "append", n, [&](){
+        std::string s;
+        for(int i = 0; i < n; i++){
+            s += static_cast<char>('a' + i % 26);
+        }
+        return (long long)s.size();
+    });
+
+    std::string text;
+    for(int i = 0; i < n; i++){
+        text += static_cast<char>('a' + i % 26);
+    }
+    DSString ds = text.c_str();
+    const std::string& st = text;
+
+    measure("string", "DSString", "index", n, [&](){
+        long long sum = 0;
+        for(int i = 0; i < n; i++){
+            sum += ds[i];
+        }
+        return sum;
+    });
+    measure("string", "std::string", "index", n, [&](){
+        long long sum = 0;
+        for(int i = 0; i < n; i++){
+            sum += st[i];
+        }
+        return sum;
+    });
+
+    measure("string", "DSString", "iterate", n, [&](){
+        long long sum = 0;
+        for(char c : ds){
+            sum += c;
+        }
+        return sum;
+    });
+    measure("string", "std::string", "iterate", n, [&](){
+        long long sum = 0;
+        for(char c : st){
+            sum += c;
+        }
+        return sum;
+    });
+
+    measure("string", "DSString", "copy", n, [&](){
+        DSString copy = ds;
+        return (long long)copy.size();
+    });
+    measure("string", "std::string", "copy", n, [&](){
+        std::string copy = st;
+        return (long long)copy.size();
+    });
+
+    measure("string", "DSString", "concat", 2LL * n, [&](){
+        DSString joined = ds + ds;
+        return (long long)joined.size();
+    });
+    measure("string", "std::string", "concat", 2LL * n, [&](){
+        std::string joined = st + st;
+        return (long long)joined.size();
+    });
+
+    measure("string", "DSString", "search", n, [&](){
+        return (long long)ds.findChar('#');
+    });
+    measure("string", "std::string", "search", n, [&](){
+        return (long long)st.find('#');
+    });
+}
+
+/**
+ * @brief benchMaps - insertion, lookups by name, missed lookups and erasure for DSHashMap and std::unordered_map,
+ * plus reuse of an int keyed map as the visited set of repeated searches
+ * @param n - number of keys
+ */
+void benchMaps(const int n)
+{
+    // airport style names, the DS lookups go through views of one buffer the way the parsers do
+    std::vector<std::string> names;
+    std::string text;
+    for(int i = 0; i < n; i++){
+        names.push_back("AP" + std::to_string(i * 7919LL));
+        text += names.back();
+    }
+
+    std::vector<DSStringView> views;
+    size_t offset = 0;
+    for(int i = 0; i < n; i++){
+        views.push_back(DSStringView(text.c_str() + offset, int(names[i].size())));
+        offset += names[i].size();
+    }
+
+    measure("map", "DSHashMap", "insert", n, [&](){
+        DSHashMap<DSString, int> map;
+        for(int i = 0; i < n; i++){
+            map.insert(views[i], i);
+        }
+        return (long long)map.size();
+    });
+    measure("map", "std::unordered_map", "insert", n, [&](){
+        std::unordered_map<std::string, int> map;
+        for(int i = 0; i < n; i++){
+            map.emplace(names[i], i);
+        }
+        return (long long)map.size();
+    });
+
+    DSHashMap<DSString, int> ds;
+    std::unordered_map<std::string, int> st;
+    for(int i = 0; i < n; i++){
+        ds.insert(views[i], i);
+        st.emplace(names[i], i);
+    }
+
+    measure("map", "DSHashMap", "find", n, [&](){
+        long long sum = 0;
+        for(int i = 0; i < n; i++){
+            sum += *ds.find(views[i]);
+        }
+        return sum;
+    });
+    measure("map", "std::unordered_map", "find", n, [&](){
+        long long sum = 0;
+        for(int i = 0; i < n; i++){
+            sum += st.find(names[i])->second;
+        }
+        return sum;
+    });
+
+    measure("map", "DSHashMap", "miss", n, [&](){
+        long long sum = 0;
+        for(int i = 0; i < n; i++){
+            // dropping the first character gives names that are not stored
+            sum += ds.contains(views[i].substring(1, views[i].size() - 1));
+        }
+        return sum;
+    });
+    measure("map", "std::unordered_map", "miss", n, [&](){
+        long long sum = 0;
+        for(int i = 0; i < n; i++){
+            sum += st.count(names[i].substr(1));
+        }
+        return sum;
+    });
+
+    measure("map", "DSHashMap", "erase", n, [&](){
+        DSHashMap<DSString, int> copy = ds;
+        for(int i = 0; i < n; i++){
+            copy.erase(views[i]);
+        }
+        return (long long)copy.size();
+    });
+    measure("map", "std::unordered_map", "erase", n, [&](){
+        std::unordered_map<std::string, int> copy = st;
+        for(int i = 0; i < n; i++){
+            copy.erase(names[i]);
+        }
+        return (long long)copy.size();
+    });
+
+    // ten searches each labelling a tenth of the airports, clearing the set between them
+    DSHashMap<int, int> dsVisited;
+    std::unordered_map<int, int> stVisited;
+    measure("map", "DSHashMap", "visited", n, [&](){
+        long long sum = 0;
+        for(int search = 0; search < 10; search++){
+            dsVisited.clear();
+            for(int i = search; i < n; i += 10){
+                dsVisited[int(i * 7919LL % n)] = i;
+            }
+            sum += dsVisited.size();
+        }
+        return sum;
+    });
+    measure("map", "std::unordered_map", "visited", n, [&](){
+        long long sum = 0;
+        for(int search = 0; search < 10; search++){
+            stVisited.clear();
+            for(int i = search; i < n; i += 10){
+                stVisited[int(i * 7919LL % n)] = i;
+            }
+            sum += stVisited.size();
+        }
+        return sum;
+    });
+}
+
+/**
+ * @brief benchQueues - push, pop, decrease-key and reuse for DSPriorityQueue and std::priority_queue, the std queue
+ * handles a lowered key the way the searches did, by pushing it again and skipping the stale entry when popped
+ * @param n - number of values
+ */
+void benchQueues(const int n)
+{
+    typedef std::pair<int, int> Entry;
+    typedef std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> StdQueue;
+
+    // scattered keys, so pushes and pops do not arrive in heap order
+    std::vector<int> keys;
+    for(int i = 0; i < n; i++){
+        keys.push_back(int(i * 7919LL % n));
+    }
+
+    measure("queue", "DSPriorityQueue", "push", n, [&](){
+        DSPriorityQueue<int, int> queue;
+        for(int i = 0; i < n; i++){
+            queue.push(keys[i], i);
+        }
+        return (long long)queue.size();
+    });
+    measure("queue", "std::priority_queue", "push", n, [&](){
+        StdQueue queue;
+        for(int i = 0; i < n; i++){
+            queue.push(Entry(keys[i], i));
+        }
+        return (long long)queue.size();
+    });
+
+    DSPriorityQueue<int, int> ds;
+    StdQueue st;
+    for(int i = 0; i < n; i++){
+        ds.push(keys[i], i);
+        st.push(Entry(keys[i], i));
+    }
+
+    measure("queue", "DSPriorityQueue", "pop", n, [&](){
+        DSPriorityQueue<int, int> copy = ds;
+        long long sum = 0;
+        while(!copy.empty()){
+            sum += copy.topValue();
+            copy.pop();
+        }
+        return sum;
+    });
+    measure("queue", "std::priority_queue", "pop", n, [&](){
+        StdQueue copy = st;
+        long long sum = 0;
+        while(!copy.empty()){
+            sum += copy.top().second;
+            copy.pop();
+        }
+        return sum;
+    });
+
+    // every value is relaxed four times with a lower key each time, then the queue is drained like a Dijkstra
+    measure("queue", "DSPriorityQueue", "decrease", 4LL * n, [&](){
+        DSPriorityQueue<int, int> queue;
+        for(int round = 0; round < 4; round++){
+            for(int i = 0; i < n; i++){
+                queue.pushOrDecrease(keys[i] + (3 - round) * n, i);
+            }
+        }
+
+        long long sum = 0;
+        while(!queue.empty()){
+            sum += queue.topValue();
+            queue.pop();
+        }
+        return sum;
+    });
+    measure("queue", "std::priority_queue", "decrease", 4LL * n, [&](){
+        StdQueue queue;
+        std::vector<int> best(n, 0x7FFFFFFF);
+        for(int round = 0; round < 4; round++){
+            for(int i = 0; i < n; i++){
+                int key = keys[i] + (3 - round) * n;
+                if(key < best[i]){
+                    best[i] = key;
+                    queue.push(Entry(key, i));
+                }
+            }
+        }
+
+        long long sum = 0;
+        while(!queue.empty()){
+            Entry entry = queue.top();
+            queue.pop();
+            if(entry.first == best[entry.second]){
+                sum += entry.second;
+            }
+        }
+        return sum;
+    });
+
+    // ten searches each queueing a tenth of the values, the DS queue is cleared and the std queue is rebuilt
+    DSPriorityQueue<int, int> dsReused;
+    measure("queue", "DSPriorityQueue", "reuse", n, [&](){
+        long long sum = 0;
+        for(int search = 0; search < 10; search++){
+            dsReused.clear();
+            for(int i = search; i < n; i += 10){
+                dsReused.push(keys[i], i);
+            }
+            while(!dsReused.empty()){
+                sum += dsReused.topValue();
+                dsReused.pop();
+            }
+        }
+        return sum;
+    });
+    measure("queue", "std::priority_queue", "reuse", n, [&](){
+        long long sum = 0;
+        for(int search = 0; search < 10; search++){
+            StdQueue queue;
+            for(int i = search; i < n; i += 10){
+                queue.push(Entry(keys[i], i));
+            }
+            while(!queue.empty()){
+                sum += queue.top().second;
+                queue.pop();
+            }
+        }
+        return sum;
+    });
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    int n = 10000;
+    int lookups = 1000;
+    std::string outputPath;
+
+    for(int arg = 1; arg < argc; arg += 2){
+        if(arg + 1 >= argc){
+            std::cerr << "Usage: flightplanner_containerbench [--size N] [--lookups N] [--repeat N] [--output file.json]" << std::endl;
+            return 1;
+        }
+
+        if(std::strcmp(argv[arg], "--size") == 0){
+            n = std::max(1, std::atoi(argv[arg + 1]));
+        } else if(std::strcmp(argv[arg], "--lookups") == 0){
+            lookups = std::max(1, std::atoi(argv[arg + 1]));
+        } else if(std::strcmp(argv[arg], "--repeat") == 0){
+            repeat = std::max(1, std::atoi(argv[arg + 1]));
+        } else if(std::strcmp(argv[arg], "--output") == 0){
+            outputPath = argv[arg + 1];
+        } else {
+            std::cerr << "Usage: flightplanner_containerbench [--size N] [--lookups N] [--repeat N] [--output file.json]" << std::endl;
+            return 1;
+        }
+    }
+
+    benchVectors(n);
+    benchLists(n, lookups);
+    benchStacks(n);
+    benchStrings(n);
+    benchMaps(n);
+    benchQueues(n);
+
+    // each DS result is followed by its std baseline, so the ratio compares neighbouring entries
+    std::ostringstream json;
+    json << "{\n  \"benchmark\": \"containers\",\n  \"format\": 1,\n"
+         << "  \"config\": {\"size\": " << n << ", \"lookups\": " << lookups << ", \"repeat\": " << repeat << "},\n"
+         << "  \"results\": [\n";
+    for(size_t i = 0; i < results.size(); i++){
+        const Result& result = results[i];
+        json << "    {\"family\": \"" << result.family << "\", \"container\": \"" << result.container
+             << "\", \"operation\": \"" << result.operation << "\", \"elements\": " << result.elements
+             << ", \"ns_per_element\": " << result.nsPerElement
+             << ", \"allocations_per_run\": " << result.allocationsPerRun
+             << ", \"bytes_per_run\": " << result.bytesPerRun;
+
+        if(i % 2 == 0 && i + 1 < results.size() && results[i + 1].nsPerElement > 0){
+            json << ", \"ratio_to_std\": " << result.nsPerElement / results[i + 1].nsPerElement;
+        }
+
+        json << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    json << "  ]\n}\n";
+
+    if(outputPath.empty()){
+        std::cout << json.str();
+    } else {
+        std::ofstream file(outputPath);
+        file << json.str();
+        if(file.fail()){
+            std::cerr << "Could not write results: " << outputPath << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
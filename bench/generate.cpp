@@ -0,0 +1,50 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "benchoptions.h"
+#include "networkgenerator.h"
+
+int main(int argc, char* argv[])
+{
+    NetworkGenerator::Options options;
+    int numRequests = 100;
+    double costShare = 0.5;
+
+    int arg = 1;
+    while(arg < argc && std::strncmp(argv[arg], "--", 2) == 0){
+        if(parseNetworkOption(argc, argv, arg, options)){
+            continue;
+        }
+
+        if(std::strcmp(argv[arg], "--requests") == 0 && arg + 1 < argc){
+            numRequests = std::atoi(argv[arg + 1]);
+            arg += 2;
+        } else if(std::strcmp(argv[arg], "--cost-share") == 0 && arg + 1 < argc){
+            costShare = std::atof(argv[arg + 1]);
+            arg += 2;
+        } else {
+            std::cerr << "Unknown option: " << argv[arg] << std::endl;
+            return 1;
+        }
+    }
+
+    if(argc - arg < 2){
+        std::cerr << "Usage: flightplanner_gen " NETWORK_OPTIONS_USAGE " [--requests N] [--cost-share S] <flight data> <flight plans>" << std::endl;
+        return 1;
+    }
+
+    NetworkGenerator generator(options);
+
+    if(!generator.writeFlights(argv[arg])){
+        std::cerr << "Could not write flight data file: " << argv[arg] << std::endl;
+        return 1;
+    }
+
+    if(!generator.writeRequests(argv[arg + 1], numRequests, costShare)){
+        std::cerr << "Could not write flight plans file: " << argv[arg + 1] << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include "networkgenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <string>
+
+/**
+ * @brief NetworkGenerator - constructor, places the airports and precomputes the endpoint weights
+ * @param options - size and shape of the network
+ */
+NetworkGenerator::NetworkGenerator(const Options& options) : options(options), random(options.seed)
+{
+    if(this->options.airports < 2){
+        this->options.airports = 2;
+    }
+    if(this->options.airlines < 1){
+        this->options.airlines = 1;
+    }
+    this->options.hubs = std::max(1, std::min(this->options.hubs, this->options.airports));
+
+    std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+    double total = 0;
+    for(int i = 0; i < this->options.airports; i++){
+        x.push_back(coordinate(random));
+        y.push_back(coordinate(random));
+
+        total += 1.0 / std::pow(i + 1, this->options.skew);
+        airportWeights.push_back(total);
+
+        if(i < this->options.hubs){
+            hubWeights.push_back(total);
+        }
+    }
+
+    std::uniform_real_distribution<double> price(0.6, 1.4);
+    for(int i = 0; i < this->options.airlines; i++){
+        priceFactors.push_back(price(random));
+    }
+}
+
+/**
+ * @brief writeFlights - writes the flight count, then one line per flight, most of them between a spoke and a hub
+ * @param filePath - path of the file to write
+ * @return true if the file was written
+ */
+bool NetworkGenerator::writeFlights(const DSString& filePath)
+{
+    std::ofstream file(filePath.c_str());
+    if(!file.is_open()){
+        return false;
+    }
+
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::uniform_int_distribution<int> airline(0, options.airlines - 1);
+    std::uniform_int_distribution<int> noise(0, 20);
+
+    file << options.flights << "\n";
+    for(int i = 0; i < options.flights; i++){
+        int origin;
+        int dest;
+        if(unit(random) < options.hubShare){
+            origin = pick(airportWeights);
+            dest = pick(hubWeights);
+        } else {
+            origin = pick(airportWeights);
+            dest = pick(airportWeights);
+        }
+
+        if(origin == dest){
+            dest = (dest + 1) % options.airports;
+        }
+
+        int carrier = airline(random);
+        double distance = std::hypot(x[origin] - x[dest], y[origin] - y[dest]);
+        int time = 30 + static_cast<int>(distance / 5) + noise(random);
+        int cost = 40 + static_cast<int>(distance / 4 * priceFactors[carrier]) + noise(random);
+
+        file << airportName(origin) << " " << airportName(dest) << " " << time << " " << cost << " AL" << carrier << "\n";
+    }
+
+    return !file.fail();
+}
+
+/**
+ * @brief writeRequests - writes the request count, then one route per line with its objective
+ * @param filePath - path of the file to write
+ * @param numRequests - number of requests
+ * @param costShare - share of requests ranked by cost
+ * @return true if the file was written
+ */
+bool NetworkGenerator::writeRequests(const DSString& filePath, const int numRequests, const double costShare)
+{
+    std::ofstream file(filePath.c_str());
+    if(!file.is_open()){
+        return false;
+    }
+
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    file << numRequests << "\n";
+    for(int i = 0; i < numRequests; i++){
+        int origin;
+        int dest;
+        randomRoute(origin, dest);
+
+        file << airportName(origin) << " " << airportName(dest) << " " << (unit(random) < costShare ? 'C' : 'T') << "\n";
+    }
+
+    return !file.fail();
+}
+
+/**
+ * @brief airportName - returns the name of an airport as written to the files
+ * @param airport - index of the airport
+ * @return name of the airport
+ */
+DSString NetworkGenerator::airportName(const int airport)
+{
+    return DSString(("AP" + std::to_string(airport)).c_str());
+}
+
+/**
+ * @brief randomRoute - picks two distinct airports with the same weights as the flights
+ * @param origin - set to the first airport
+ * @param dest - set to the second airport
+ */
+void NetworkGenerator::randomRoute(int& origin, int& dest)
+{
+    origin = pick(airportWeights);
+    dest = pick(airportWeights);
+
+    if(origin == dest){
+        dest = (dest + 1) % options.airports;
+    }
+}
+
+/**
+ * @brief pick - draws a point below the total weight and binary searches the running sums for it
+ * @param weights - running sums of the weights
+ * @return index drawn
+ */
+int NetworkGenerator::pick(const std::vector<double>& weights)
+{
+    std::uniform_real_distribution<double> point(0.0, weights.back());
+
+    int index = std::upper_bound(weights.begin(), weights.end(), point(random)) - weights.begin();
+
+    // rounding can put the point on the total itself
+    return std::min(index, static_cast<int>(weights.size()) - 1);
+}
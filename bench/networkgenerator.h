@@ -0,0 +1,92 @@
+#ifndef NETWORKGENERATOR_H
+#define NETWORKGENERATOR_H
+
+#include <random>
+#include <vector>
+
+#include "DataStructures/DSString/dsstring.h"
+
+/**
+ * @brief The NetworkGenerator class - writes synthetic hub and spoke flight data and matching plans files
+ *
+ * Airports are placed at random on a map and ranked, airport i is picked as a flight endpoint with weight
+ * 1 / (i + 1)^skew, and most flights connect a spoke to one of the first hubs airports. Times grow with distance
+ * and costs with distance times a per airline price factor, so fast and cheap routes differ. Output only depends
+ * on the options, including the seed.
+ */
+class NetworkGenerator
+{
+public:
+    /**
+     * @brief The Options struct - size and shape of the generated network
+     */
+    struct Options{
+        int airports = 1000;
+        int flights = 10000;
+        int airlines = 10;
+        int hubs = 20;
+        // exponent of the endpoint weights, 0 spreads flights evenly
+        double skew = 1.0;
+        // share of flights with a hub at one end
+        double hubShare = 0.7;
+        unsigned int seed = 1;
+    };
+
+    /**
+     * @brief NetworkGenerator - constructor, places the airports
+     * @param options - size and shape of the network
+     */
+    NetworkGenerator(const Options& options);
+
+    /**
+     * @brief writeFlights - writes a flight data file
+     * @param filePath - path of the file to write
+     * @return true if the file was written
+     */
+    bool writeFlights(const DSString& filePath);
+
+    /**
+     * @brief writeRequests - writes a plans file of random routes between distinct airports
+     * @param filePath - path of the file to write
+     * @param numRequests - number of requests
+     * @param costShare - share of requests ranked by cost
+     * @return true if the file was written
+     */
+    bool writeRequests(const DSString& filePath, const int numRequests, const double costShare = 0.5);
+
+    /**
+     * @brief airportName - returns the name of an airport as written to the files
+     * @param airport - index of the airport
+     * @return name of the airport
+     */
+    static DSString airportName(const int airport);
+
+    /**
+     * @brief randomRoute - picks two distinct airports with the same weights as the flights
+     * @param origin - set to the first airport
+     * @param dest - set to the second airport
+     */
+    void randomRoute(int& origin, int& dest);
+
+private:
+    Options options;
+    std::mt19937 random;
+
+    std::vector<double> x;
+    std::vector<double> y;
+
+    // running sums of the endpoint weights of all airports and of the hubs
+    std::vector<double> airportWeights;
+    std::vector<double> hubWeights;
+
+    std::vector<double> priceFactors;
+
+    /**
+     * @brief pick - draws an index with probability proportional to its weight
+     * @param weights - running sums of the weights
+     * @return index drawn
+     */
+    int pick(const std::vector<double>& weights);
+};
+
+#endif // NETWORKGENERATOR_H
@@ -0,0 +1,431 @@
+#include "branchboundsearch.h"
+
+#include <utility>
+
+/**
+ * @brief BranchBoundSearch - constructor
+ * @param network - network to search, must outlive the search
+ * @param penalties - penalties added between connecting flights
+ */
+BranchBoundSearch::BranchBoundSearch(const FlightNetwork& network, const Penalties& penalties)
+    : FlightSearch(network, penalties), objective(TIME) {}
+
+/**
+ * @brief find - runs passes of a depth first search from the start, each taking the next untried flight of the top
+ * frame, cutting it if its total plus the bound of its destination exceeds the cutoff, collecting it if it reaches
+ * the end and otherwise stacking its destination. The first pass only allows paths as good as the bound of the
+ * start, and each pass that finds fewer than k paths raises the threshold to at least the smallest total it cut,
+ * so no pass ever searches without a cutoff. Every path within the threshold is seen, so once a pass finds k the
+ * answer is exact, and as a path is only cut when it is strictly worse, ties are still ranked by comesBefore. Passes
+ * after the first skip flights that can no longer reach the end, so every cut leads to a path and the search stops
+ * as soon as a pass cuts nothing, even when fewer than k paths exist
+ * @param start - id of the starting airport
+ * @param end - id of the destination airport
+ * @param objective - criterion to minimise
+ * @param k - maximum number of paths to return
+ * @return up to k paths, best first
+ */
+DSVector<FlightSearch::Path> BranchBoundSearch::find(const int start, const int end, const Objective objective, const int k)
+{
+    this->objective = objective;
+    this->k = k;
+    this->end = end;
+
+    stats = SearchStats();
+    SEARCH_STAT(SearchStats::Timer timer(stats.seconds));
+
+    best.clear();
+    if(k <= 0 || start == end){
+        return best;
+    }
+
+    computeBounds(end);
+    if(remaining.getData()[start] == UNREACHABLE){
+        return best;
+    }
+
+    threshold = remaining.getData()[start];
+    checkReachable = false;
+
+    while(true){
+        best.clear();
+        frames.clear();
+        children.clear();
+        route.clear();
+        nextThreshold = UNREACHABLE;
+
+        pushFrame(start, -1, 0, 0);
+
+        while(!frames.empty()){
+            Frame& frame = frames.top();
+            if(frame.nextChild == frame.endChild){
+                popFrame();
+                continue;
+            }
+
+            int edge = children.getData()[frame.nextChild++];
+            const FlightNetwork::Edge& flight = network.getEdge(edge);
+
+            int time = frame.time + flight.time + connectionTime(frame.edge, edge);
+            int cost = frame.cost + flight.cost + connectionCost(frame.edge, edge);
+            long long bound = (objective == TIME ? time : cost) + static_cast<long long>(remaining.getData()[flight.dest]);
+
+            if(bound > cutoff()){
+                if(bound < nextThreshold){
+                    nextThreshold = bound;
+                }
+
+                SEARCH_STAT(stats.pruned++);
+                continue;
+            }
+
+            if(flight.dest == end){
+                collect(edge);
+                continue;
+            }
+
+            pushFrame(flight.dest, edge, time, cost);
+        }
+
+        // done once k paths are within the threshold or nothing was cut by it
+        if(best.getNumIndexes() == k || nextThreshold == UNREACHABLE){
+            break;
+        }
+
+        checkReachable = true;
+
+        // grow by at least an eighth so a network with many distinct totals does not take a pass per total
+        threshold += threshold / 8;
+        if(nextThreshold > threshold){
+            threshold = nextThreshold;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief buildReverse - counts the flights into each airport, turns the counts into offsets and places every flight
+ * in its destination's range, only on the first search or once the network changed since
+ */
+void BranchBoundSearch::buildReverse()
+{
+    int numAirports = network.airportCount();
+    if(reverseChanges == network.changeCount()){
+        return;
+    }
+    reverseChanges = network.changeCount();
+
+    reverseOffsets.clear();
+    reverseOffsets.reserve(numAirports + 1);
+    for(int i = 0; i <= numAirports; i++){
+        reverseOffsets.pushBack(0);
+    }
+
+    int* offsetData = reverseOffsets.getData();
+    for(int airport = 0; airport < numAirports; airport++){
+        for(int e = network.firstEdge(airport); e < network.lastEdge(airport); e++){
+            offsetData[network.getEdge(e).dest + 1]++;
+        }
+    }
+    for(int i = 0; i < numAirports; i++){
+        offsetData[i + 1] += offsetData[i];
+    }
+
+    reverseFlights.clear();
+    reverseFlights.reserve(offsetData[numAirports]);
+    for(int i = 0; i < offsetData[numAirports]; i++){
+        reverseFlights.emplaceBack();
+    }
+
+    // each offset walks to the end of its range while filling, then they are shifted back to the range starts
+    ReverseFlight* reverseData = reverseFlights.getData();
+    for(int airport = 0; airport < numAirports; airport++){
+        for(int e = network.firstEdge(airport); e < network.lastEdge(airport); e++){
+            int slot = offsetData[network.getEdge(e).dest]++;
+            reverseData[slot].origin = airport;
+            reverseData[slot].edge = e;
+        }
+    }
+    for(int i = numAirports; i > 0; i--){
+        offsetData[i] = offsetData[i - 1];
+    }
+    offsetData[0] = 0;
+
+    visited.clear();
+    reached.clear();
+    for(int i = 0; i < (numAirports + 63) / 64; i++){
+        visited.pushBack(0);
+    }
+    for(int i = 0; i < numAirports; i++){
+        reached.pushBack(0);
+    }
+    reachStamp = 0;
+}
+
+/**
+ * @brief computeBounds - runs Dijkstra from the destination over the flights grouped by destination, weighting each
+ * by its objective plus the smallest connection penalty. Every flight after the first one of a path pays that
+ * penalty, so remaining is a lower bound for any airport reached by a flight
+ * @param end - id of the destination airport
+ */
+void BranchBoundSearch::computeBounds(const int end)
+{
+    buildReverse();
+
+    int numAirports = network.airportCount();
+    const int* offsetData = reverseOffsets.getData();
+    const ReverseFlight* reverseData = reverseFlights.getData();
+
+    int layover = objective == TIME ? penalties.layoverTime : penalties.layoverCost;
+    int airlineChange = objective == TIME ? penalties.airlineChangeTime : penalties.airlineChangeCost;
+    int connection = airlineChange < 0 ? layover + airlineChange : layover;
+    if(connection < 0){
+        connection = 0;
+    }
+
+    remaining.clear();
+    remaining.reserve(numAirports);
+    for(int i = 0; i < numAirports; i++){
+        remaining.pushBack(0);
+    }
+
+    int* remainingData = remaining.getData();
+    for(int i = 0; i < numAirports; i++){
+        remainingData[i] = UNREACHABLE;
+    }
+
+    boundQueue.clear();
+    boundQueue.reserve(numAirports);
+
+    remainingData[end] = 0;
+    boundQueue.push(0, end);
+
+    while(!boundQueue.empty()){
+        int airport = boundQueue.topValue();
+        boundQueue.pop();
+
+        for(int i = offsetData[airport]; i < offsetData[airport + 1]; i++){
+            const ReverseFlight& flight = reverseData[i];
+            int bound = remainingData[airport] + primaryOf(flight.edge) + connection;
+
+            if(bound < remainingData[flight.origin]){
+                remainingData[flight.origin] = bound;
+                boundQueue.pushOrDecrease(bound, flight.origin);
+            }
+        }
+    }
+}
+
+/**
+ * @brief markReachable - walks the flights grouped by destination breadth first from the end, never entering an
+ * airport on the current path, and stamps every airport it reaches. A new stamp forgets the previous walk without
+ * clearing the array
+ */
+void BranchBoundSearch::markReachable()
+{
+    if(reachStamp == 0x7FFFFFFF){
+        int* reachedData = reached.getData();
+        for(int i = 0; i < reached.getNumIndexes(); i++){
+            reachedData[i] = 0;
+        }
+        reachStamp = 0;
+    }
+    reachStamp++;
+
+    int* reachedData = reached.getData();
+    const int* offsetData = reverseOffsets.getData();
+    const ReverseFlight* reverseData = reverseFlights.getData();
+
+    reachQueue.clear();
+    reachQueue.pushBack(end);
+    reachedData[end] = reachStamp;
+
+    for(int i = 0; i < reachQueue.getNumIndexes(); i++){
+        int airport = reachQueue.getData()[i];
+
+        for(int j = offsetData[airport]; j < offsetData[airport + 1]; j++){
+            int origin = reverseData[j].origin;
+
+            if(reachedData[origin] != reachStamp && !isVisited(origin)){
+                reachedData[origin] = reachStamp;
+                reachQueue.pushBack(origin);
+            }
+        }
+    }
+}
+
+/**
+ * @brief pushFrame - marks the airport, appends its flights to unvisited airports that can still reach the
+ * destination and insertion sorts them by objective plus the bound of where they land. Once a pass came up short,
+ * a destination also has to reach the end without the airports of the current path
+ * @param airport - id of the airport
+ * @param edge - flight the airport was reached by, -1 at the starting airport
+ * @param time - time of the path so far
+ * @param cost - cost of the path so far
+ */
+void BranchBoundSearch::pushFrame(const int airport, const int edge, const int time, const int cost)
+{
+    setVisited(airport, true);
+    if(edge != -1){
+        route.pushBack(edge);
+    }
+
+    Frame frame;
+    frame.airport = airport;
+    frame.edge = edge;
+    frame.time = time;
+    frame.cost = cost;
+    frame.firstChild = children.getNumIndexes();
+    frame.nextChild = frame.firstChild;
+
+    if(checkReachable){
+        markReachable();
+    }
+
+    const int* remainingData = remaining.getData();
+    const int* reachedData = reached.getData();
+    for(int e = network.firstEdge(airport); e < network.lastEdge(airport); e++){
+        SEARCH_STAT(stats.relaxed++);
+        int dest = network.getEdge(e).dest;
+
+        if(isVisited(dest) || remainingData[dest] == UNREACHABLE || (checkReachable && reachedData[dest] != reachStamp)){
+            SEARCH_STAT(stats.pruned++);
+            continue;
+        }
+
+        children.pushBack(e);
+    }
+    frame.endChild = children.getNumIndexes();
+
+    int* childData = children.getData();
+    auto key = [&](const int e){
+        int connection = objective == TIME ? connectionTime(edge, e) : connectionCost(edge, e);
+        return static_cast<long long>(primaryOf(e)) + connection + remainingData[network.getEdge(e).dest];
+    };
+
+    for(int i = frame.firstChild + 1; i < frame.endChild; i++){
+        int current = childData[i];
+        long long currentKey = key(current);
+        int j = i - 1;
+
+        while(j >= frame.firstChild && key(childData[j]) > currentKey){
+            childData[j + 1] = childData[j];
+            j--;
+        }
+
+        childData[j + 1] = current;
+    }
+
+    frames.push(frame);
+    SEARCH_STAT(stats.settled++);
+    SEARCH_STAT(stats.frontier(children.getNumIndexes()));
+}
+
+/**
+ * @brief popFrame - unmarks the top airport and drops its frame, its flights and its leg of the route
+ */
+void BranchBoundSearch::popFrame()
+{
+    const Frame& frame = frames.top();
+
+    setVisited(frame.airport, false);
+    if(frame.edge != -1){
+        route.removeLast();
+    }
+
+    while(children.getNumIndexes() > frame.firstChild){
+        children.removeLast();
+    }
+
+    frames.pop();
+}
+
+/**
+ * @brief cutoff - returns the objective of the k-th best path once k paths are known, and the threshold of the
+ * pass until then
+ * @return largest total plus bound a path may have to be searched
+ */
+long long BranchBoundSearch::cutoff() const
+{
+    if(best.getNumIndexes() < k){
+        return threshold;
+    }
+
+    const Path& last = best.back();
+    if(objective == TIME){
+        return last.totalTime;
+    }
+
+    return last.totalCost;
+}
+
+/**
+ * @brief collect - builds the path, drops it if it ranks after the k-th best, and otherwise insertion sorts it into
+ * the best paths, dropping the old k-th
+ * @param edge - flight arriving at the destination
+ */
+void BranchBoundSearch::collect(const int edge)
+{
+    Path path;
+    path.edges.reserve(route.getNumIndexes() + 1);
+    for(int i = 0; i < route.getNumIndexes(); i++){
+        addLeg(path, route.getData()[i]);
+    }
+    addLeg(path, edge);
+
+    if(best.getNumIndexes() == k){
+        if(!comesBefore(path, best.back(), objective)){
+            SEARCH_STAT(stats.pruned++);
+            return;
+        }
+
+        best.removeLast();
+    }
+
+    SEARCH_STAT(stats.bytes += sizeof(Path) + path.edges.getNumIndexes() * sizeof(int));
+    best.pushBack(std::move(path));
+
+    Path* bestData = best.getData();
+    for(int i = best.getNumIndexes() - 1; i > 0 && comesBefore(bestData[i], bestData[i - 1], objective); i--){
+        std::swap(bestData[i], bestData[i - 1]);
+    }
+}
+
+/**
+ * @brief primaryOf - returns the objective of a flight alone
+ * @param edge - flight
+ * @return time or cost of the flight
+ */
+int BranchBoundSearch::primaryOf(const int edge) const
+{
+    const FlightNetwork::Edge& flight = network.getEdge(edge);
+
+    return objective == TIME ? flight.time : flight.cost;
+}
+
+/**
+ * @brief isVisited - returns true if an airport is on the current path
+ * @param airport - id of the airport
+ * @return true if the bit of the airport is set
+ */
+bool BranchBoundSearch::isVisited(const int airport) const
+{
+    return (visited.getData()[airport >> 6] >> (airport & 63)) & 1;
+}
+
+/**
+ * @brief setVisited - sets or clears the bit of an airport
+ * @param airport - id of the airport
+ * @param value - true to mark the airport
+ */
+void BranchBoundSearch::setVisited(const int airport, const bool value)
+{
+    unsigned long long bit = 1ull << (airport & 63);
+
+    if(value){
+        visited.getData()[airport >> 6] |= bit;
+    } else {
+        visited.getData()[airport >> 6] &= ~bit;
+    }
+}
@@ -0,0 +1,172 @@
+#ifndef BRANCHBOUNDSEARCH_H
+#define BRANCHBOUNDSEARCH_H
+
+#include "DataStructures/DSPriorityQueue/dspriorityqueue.h"
+#include "DataStructures/DSStack/dsstack.h"
+#include "DataStructures/DSVector/dsvector.h"
+#include "flightsearch.h"
+
+/**
+ * @brief The BranchBoundSearch class - depth first enumeration of loopless paths, pruned against the best k so far
+ *
+ * The search walks an explicit stack of stops and keeps the best k paths found in a sorted collector. Before a stop
+ * is expanded, its total so far plus a lower bound on the rest of the trip is compared with the k-th best path, and
+ * the whole subtree is cut once it cannot beat it. The bound comes from a reverse shortest path search to the
+ * destination in which every flight pays at least the layover penalty, so it never overestimates and the answers
+ * are exact. Flights are tried best bound first, so good paths are found early and tighten the cut.
+ *
+ * Until k paths are known there is nothing to cut against, and a depth first walk that strays can enumerate every
+ * loopless path of the network. The search therefore runs in passes with a threshold that starts at the bound of the
+ * starting airport and grows each pass that finds fewer than k paths, like iterative deepening A*. The bound ignores
+ * the airports already on the path, so from the second pass on a flight is only tried if its destination can still
+ * reach the end without them. Otherwise a pair with fewer than k paths would keep widening the threshold over
+ * branches that can never arrive. The flights grouped by destination are built on the first search and reused
+ * until the network changes.
+ */
+class BranchBoundSearch : public FlightSearch
+{
+public:
+    /**
+     * @brief BranchBoundSearch - constructor
+     * @param network - network to search, must outlive the search
+     * @param penalties - penalties added between connecting flights
+     */
+    BranchBoundSearch(const FlightNetwork& network, const Penalties& penalties);
+
+    /**
+     * @brief find - returns the best k loopless paths between two airports
+     * @param start - id of the starting airport
+     * @param end - id of the destination airport
+     * @param objective - criterion to minimise
+     * @param k - maximum number of paths to return
+     * @return up to k paths, best first
+     */
+    DSVector<Path> find(const int start, const int end, const Objective objective, const int k);
+
+private:
+    /**
+     * @brief The Frame struct - a stop on the current path and the flights left to try from it
+     */
+    struct Frame{
+        int airport;
+        // flight the stop was reached by, -1 at the starting airport
+        int edge;
+        int time;
+        int cost;
+        // range of children holding the flights to try, next is the one tried next
+        int firstChild;
+        int nextChild;
+        int endChild;
+    };
+
+    /**
+     * @brief The ReverseFlight struct - a flight stored at its destination
+     */
+    struct ReverseFlight{
+        int origin;
+        int edge;
+    };
+
+    static const int UNREACHABLE = 0x7FFFFFFF;
+
+    Objective objective;
+    int k = 0;
+    int end = 0;
+
+    // largest total plus bound searched by the current pass, and the smallest one it cut
+    long long threshold = 0;
+    long long nextThreshold = 0;
+
+    // true once a pass came up short, from then on every frame only keeps flights that can still reach the end
+    bool checkReachable = false;
+
+    DSStack<Frame> frames;
+    // flights still to try from every frame on the stack, each frame's range sorted best first
+    DSVector<int> children;
+    // flights of the current path, one per frame after the first
+    DSVector<int> route;
+
+    // airports on the current path, one bit each
+    DSVector<unsigned long long> visited;
+
+    // lower bound of the objective from each airport to the destination, for an airport reached by a flight
+    DSVector<int> remaining;
+    DSVector<int> reverseOffsets;
+    DSVector<ReverseFlight> reverseFlights;
+    // change count of the network the flights were grouped from, -1 before the first search
+    int reverseChanges = -1;
+    DSPriorityQueue<int, int> boundQueue;
+
+    // airports that can reach the end without the current path hold the current stamp
+    DSVector<int> reached;
+    int reachStamp = 0;
+    DSVector<int> reachQueue;
+
+    // best paths found so far, sorted best first
+    DSVector<Path> best;
+
+    /**
+     * @brief buildReverse - groups the flights of the network by destination, unless they are grouped already
+     */
+    void buildReverse();
+
+    /**
+     * @brief computeBounds - fills remaining with a reverse shortest path search from the destination
+     * @param end - id of the destination airport
+     */
+    void computeBounds(const int end);
+
+    /**
+     * @brief markReachable - stamps every airport that can reach the end without passing through the current path
+     */
+    void markReachable();
+
+    /**
+     * @brief pushFrame - marks an airport visited and stacks it with its unvisited, reachable flights sorted by bound
+     * @param airport - id of the airport
+     * @param edge - flight the airport was reached by, -1 at the starting airport
+     * @param time - time of the path so far
+     * @param cost - cost of the path so far
+     */
+    void pushFrame(const int airport, const int edge, const int time, const int cost);
+
+    /**
+     * @brief popFrame - unmarks the top airport and drops its frame and flights
+     */
+    void popFrame();
+
+    /**
+     * @brief cutoff - returns the largest total plus bound a path may have to be searched
+     * @return objective of the k-th best path, the threshold of the pass while fewer than k are known
+     */
+    long long cutoff() const;
+
+    /**
+     * @brief collect - offers the current path followed by a flight into the destination to the best k
+     * @param edge - flight arriving at the destination
+     */
+    void collect(const int edge);
+
+    /**
+     * @brief primaryOf - returns the objective of a flight alone
+     * @param edge - flight
+     * @return time or cost of the flight
+     */
+    int primaryOf(const int edge) const;
+
+    /**
+     * @brief isVisited - returns true if an airport is on the current path
+     * @param airport - id of the airport
+     * @return true if the bit of the airport is set
+     */
+    bool isVisited(const int airport) const;
+
+    /**
+     * @brief setVisited - sets or clears the bit of an airport
+     * @param airport - id of the airport
+     * @param value - true to mark the airport
+     */
+    void setVisited(const int airport, const bool value);
+};
+
+#endif // BRANCHBOUNDSEARCH_H
@@ -0,0 +1,555 @@
+#include "flightnetwork.h"
+
+/**
+ * @brief FlightNetwork - default constructor, creates an empty network
+ */
+FlightNetwork::FlightNetwork()
+{
+    offsets.pushBack(0);
+    updateViews();
+}
+
+/**
+ * @brief FlightNetwork - copy constructor
+ * @param other - network to copy
+ */
+FlightNetwork::FlightNetwork(const FlightNetwork& other)
+{
+    *this = other;
+}
+
+/**
+ * @brief operator = : copies the network's own arrays, or points at the same attached arrays
+ * @param other - network to copy
+ * @return reference to this network
+ */
+FlightNetwork& FlightNetwork::operator=(const FlightNetwork& other)
+{
+    if(this == &other){
+        return *this;
+    }
+
+    offsets = other.offsets;
+    edges = other.edges;
+    begins = other.begins;
+    ends = other.ends;
+    limits = other.limits;
+
+    attachedOffsets = other.attachedOffsets;
+    attachedEdges = other.attachedEdges;
+    numAirports = other.numAirports;
+    numEdges = other.numEdges;
+    liveEdges = other.liveEdges;
+    abandonedEdges = other.abandonedEdges;
+    packed = other.packed;
+
+    updateViews();
+
+    return *this;
+}
+
+/**
+ * @brief build - counting sorts the flights by origin into the offset and edge arrays
+ * @param numAirports - number of airports, every origin and dest must be below this
+ * @param flights - flights to store
+ */
+void FlightNetwork::build(const int numAirports, const DSVector<Flight>& flights)
+{
+    int numFlights = flights.getNumIndexes();
+    const Flight* flightData = flights.getData();
+
+    offsets.clear();
+    offsets.setCapacity(numAirports + 1);
+    for(int i = 0; i <= numAirports; i++){
+        offsets.pushBack(0);
+    }
+
+    // count the flights leaving each airport, then turn the counts into starting offsets
+    int* offsetData = offsets.getData();
+    for(int i = 0; i < numFlights; i++){
+        offsetData[flightData[i].origin + 1]++;
+    }
+    for(int i = 0; i < numAirports; i++){
+        offsetData[i + 1] += offsetData[i];
+    }
+
+    edges.clear();
+    edges.setCapacity(numFlights);
+    for(int i = 0; i < numFlights; i++){
+        edges.pushBack(Edge());
+    }
+
+    // place each flight in its origin's range, keeping file order within an airport
+    DSVector<int> next = offsets;
+    int* nextData = next.getData();
+    Edge* edgeData = edges.getData();
+    for(int i = 0; i < numFlights; i++){
+        const Flight& flight = flightData[i];
+        Edge& edge = edgeData[nextData[flight.origin]++];
+
+        edge.dest = flight.dest;
+        edge.airline = flight.airline;
+        edge.time = flight.time;
+        edge.cost = flight.cost;
+    }
+
+    begins.clear();
+    ends.clear();
+    limits.clear();
+
+    attachedOffsets = nullptr;
+    attachedEdges = nullptr;
+    this->numAirports = numAirports;
+    numEdges = numFlights;
+    liveEdges = numFlights;
+    abandonedEdges = 0;
+    packed = true;
+
+    updateViews();
+}
+
+/**
+ * @brief attach - frees the network's own arrays and searches the given arrays in place
+ * @param numAirports - number of airports
+ * @param numEdges - number of flights
+ * @param offsets - numAirports + 1 offsets into edges
+ * @param edges - flights sorted by origin
+ */
+void FlightNetwork::attach(const int numAirports, const int numEdges, const int* offsets, const Edge* edges)
+{
+    this->offsets.clear();
+    this->offsets.shrink();
+    this->edges.clear();
+    this->edges.shrink();
+    begins.clear();
+    ends.clear();
+    limits.clear();
+
+    attachedOffsets = offsets;
+    attachedEdges = edges;
+    this->numAirports = numAirports;
+    this->numEdges = numEdges;
+    liveEdges = numEdges;
+    abandonedEdges = 0;
+    packed = true;
+
+    updateViews();
+}
+
+/**
+ * @brief clear - removes all airports and flights
+ */
+void FlightNetwork::clear()
+{
+    offsets.clear();
+    offsets.pushBack(0);
+    edges.clear();
+    begins.clear();
+    ends.clear();
+    limits.clear();
+
+    attachedOffsets = nullptr;
+    attachedEdges = nullptr;
+    numAirports = 0;
+    numEdges = 0;
+    liveEdges = 0;
+    abandonedEdges = 0;
+    packed = true;
+
+    updateViews();
+}
+
+/**
+ * @brief addEdge - appends the flight to its origin's block, first moving the block to the end of the edge array
+ * with twice the room when it is full
+ * @param origin - id of the airport the flight leaves
+ * @param edge - flight to add
+ */
+void FlightNetwork::addEdge(const int origin, const Edge& edge)
+{
+    addAirports(origin > edge.dest ? origin : edge.dest);
+    unpack();
+
+    int begin = begins.getData()[origin];
+    int end = ends.getData()[origin];
+
+    if(end == limits.getData()[origin]){
+        int degree = end - begin;
+        int capacity = degree < 2 ? 4 : degree * 2;
+        int start = numEdges;
+
+        for(int i = 0; i < capacity; i++){
+            edges.pushBack(Edge());
+        }
+        numEdges += capacity;
+
+        Edge* edgeData = edges.getData();
+        for(int i = 0; i < degree; i++){
+            edgeData[start + i] = edgeData[begin + i];
+        }
+
+        abandonedEdges += limits.getData()[origin] - begin;
+        begins.getData()[origin] = start;
+        limits.getData()[origin] = start + capacity;
+        end = start + degree;
+    }
+
+    edges.getData()[end] = edge;
+    ends.getData()[origin] = end + 1;
+    liveEdges++;
+
+    updateViews();
+    compactIfSparse();
+}
+
+/**
+ * @brief removeEdges - closes the gaps left by the removed flights inside the origin's block, keeping the order of
+ * the flights that remain
+ * @param origin - id of the airport the flights leave
+ * @param dest - id of the airport the flights arrive at
+ * @param airline - id of the airline
+ * @return number of flights removed
+ */
+int FlightNetwork::removeEdges(const int origin, const int dest, const int airline)
+{
+    if(!hasEdge(origin, dest, airline)){
+        return 0;
+    }
+
+    unpack();
+
+    Edge* edgeData = edges.getData();
+    int begin = begins.getData()[origin];
+    int end = ends.getData()[origin];
+
+    int kept = begin;
+    for(int i = begin; i < end; i++){
+        const Edge& edge = edgeData[i];
+        if(edge.dest == dest && edge.airline == airline){
+            continue;
+        }
+
+        edgeData[kept++] = edge;
+    }
+
+    int removed = end - kept;
+    ends.getData()[origin] = kept;
+    liveEdges -= removed;
+    numChanges++;
+
+    compactIfSparse();
+
+    return removed;
+}
+
+/**
+ * @brief updateEdges - scans the origin's block for flights to dest on airline and overwrites their time and cost
+ * @param origin - id of the airport the flights leave
+ * @param dest - id of the airport the flights arrive at
+ * @param airline - id of the airline
+ * @param time - new time of the flights
+ * @param cost - new cost of the flights
+ * @return number of flights updated
+ */
+int FlightNetwork::updateEdges(const int origin, const int dest, const int airline, const int time, const int cost)
+{
+    if(!hasEdge(origin, dest, airline)){
+        return 0;
+    }
+
+    unpack();
+
+    Edge* edgeData = edges.getData();
+    int updated = 0;
+    for(int i = begins.getData()[origin]; i < ends.getData()[origin]; i++){
+        Edge& edge = edgeData[i];
+        if(edge.dest == dest && edge.airline == airline){
+            edge.time = time;
+            edge.cost = cost;
+            updated++;
+        }
+    }
+    numChanges++;
+
+    return updated;
+}
+
+/**
+ * @brief compact - packs the flights back into a plain CSR layout, dropping abandoned slots and slack
+ */
+void FlightNetwork::compact()
+{
+    if(!packed){
+        repack(false);
+    }
+}
+
+/**
+ * @brief isPacked - returns whether the flights are laid out in a plain CSR layout
+ * @return true if lastEdge(a) is firstEdge(a + 1) for every airport
+ */
+bool FlightNetwork::isPacked() const
+{
+    return packed;
+}
+
+/**
+ * @brief airportCount - returns the number of airports in the network
+ * @return number of airports
+ */
+int FlightNetwork::airportCount() const
+{
+    return numAirports;
+}
+
+/**
+ * @brief edgeCount - returns the number of edge ids, abandoned slots included
+ * @return one past the largest edge id
+ */
+int FlightNetwork::edgeCount() const
+{
+    return numEdges;
+}
+
+/**
+ * @brief changeCount - returns the number of times the flights or their layout changed
+ * @return number of changes
+ */
+int FlightNetwork::changeCount() const
+{
+    return numChanges;
+}
+
+/**
+ * @brief firstEdge - returns the index of the first outgoing flight of an airport
+ * @param airport - id of the airport
+ * @return index of the first outgoing flight
+ */
+int FlightNetwork::firstEdge(const int airport) const
+{
+    return beginView[airport];
+}
+
+/**
+ * @brief lastEdge - returns the index one past the last outgoing flight of an airport
+ * @param airport - id of the airport
+ * @return index one past the last outgoing flight
+ */
+int FlightNetwork::lastEdge(const int airport) const
+{
+    return endView[airport];
+}
+
+/**
+ * @brief getEdge - returns the flight at the given index
+ * @param index - index of the flight
+ * @return reference to the flight
+ */
+const FlightNetwork::Edge& FlightNetwork::getEdge(const int index) const
+{
+    return edgeView[index];
+}
+
+/**
+ * @brief getOffsets - returns the airportCount() + 1 offsets into the edge array of a packed network
+ * @return pointer to the offsets, nullptr if the network is not packed
+ */
+const int* FlightNetwork::getOffsets() const
+{
+    return packed ? beginView : nullptr;
+}
+
+/**
+ * @brief getEdges - returns the edge array, sorted by origin
+ * @return pointer to the edges
+ */
+const FlightNetwork::Edge* FlightNetwork::getEdges() const
+{
+    return edgeView;
+}
+
+/**
+ * @brief updateViews - a packed network reads the end of each airport from the next airport's offset, an updated
+ * one from its own block arrays. Every layout change passes through here, so it also counts the change
+ */
+void FlightNetwork::updateViews()
+{
+    if(attachedOffsets != nullptr){
+        beginView = attachedOffsets;
+        edgeView = attachedEdges;
+    } else {
+        beginView = packed ? offsets.getData() : begins.getData();
+        edgeView = edges.getData();
+    }
+
+    endView = packed ? beginView + 1 : ends.getData();
+    numChanges++;
+}
+
+/**
+ * @brief unpack - copies attached arrays into the network and gives every airport a block with no slack
+ */
+void FlightNetwork::unpack()
+{
+    if(!packed){
+        return;
+    }
+
+    if(attachedOffsets != nullptr){
+        offsets.clear();
+        offsets.setCapacity(numAirports + 1);
+        for(int i = 0; i <= numAirports; i++){
+            offsets.pushBack(attachedOffsets[i]);
+        }
+
+        edges.clear();
+        edges.setCapacity(numEdges);
+        for(int i = 0; i < numEdges; i++){
+            edges.pushBack(attachedEdges[i]);
+        }
+
+        attachedOffsets = nullptr;
+        attachedEdges = nullptr;
+    }
+
+    const int* offsetData = offsets.getData();
+
+    begins.clear();
+    begins.setCapacity(numAirports);
+    ends.clear();
+    ends.setCapacity(numAirports);
+    limits.clear();
+    limits.setCapacity(numAirports);
+
+    for(int i = 0; i < numAirports; i++){
+        begins.pushBack(offsetData[i]);
+        ends.pushBack(offsetData[i + 1]);
+        limits.pushBack(offsetData[i + 1]);
+    }
+
+    packed = false;
+
+    updateViews();
+}
+
+/**
+ * @brief hasEdge - scans the airport's flights for one to dest on airline
+ * @param origin - id of the airport the flights leave
+ * @param dest - id of the airport the flights arrive at
+ * @param airline - id of the airline
+ * @return true if a matching flight exists
+ */
+bool FlightNetwork::hasEdge(const int origin, const int dest, const int airline) const
+{
+    if(origin < 0 || origin >= numAirports){
+        return false;
+    }
+
+    for(int i = beginView[origin]; i < endView[origin]; i++){
+        if(edgeView[i].dest == dest && edgeView[i].airline == airline){
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief addAirports - adds airports with empty blocks, which move on their first flight
+ * @param airport - id that must exist
+ */
+void FlightNetwork::addAirports(const int airport)
+{
+    if(airport < numAirports){
+        return;
+    }
+
+    unpack();
+
+    while(numAirports <= airport){
+        begins.pushBack(numEdges);
+        ends.pushBack(numEdges);
+        limits.pushBack(numEdges);
+        numAirports++;
+    }
+
+    updateViews();
+}
+
+/**
+ * @brief repack - copies every block in airport order into a new edge array, so no slot is abandoned
+ * @param slack - whether each block keeps room for a quarter of its flights, otherwise the result is packed
+ */
+void FlightNetwork::repack(const bool slack)
+{
+    const int* beginData = begins.getData();
+    const int* endData = ends.getData();
+    const Edge* edgeData = edges.getData();
+
+    DSVector<int> newBegins;
+    DSVector<int> newEnds;
+    DSVector<int> newLimits;
+    newBegins.setCapacity(numAirports + 1);
+    newEnds.setCapacity(numAirports);
+    newLimits.setCapacity(numAirports);
+
+    int total = 0;
+    for(int airport = 0; airport < numAirports; airport++){
+        int degree = endData[airport] - beginData[airport];
+
+        newBegins.pushBack(total);
+        newEnds.pushBack(total + degree);
+        total += degree + (slack ? degree / 4 + 1 : 0);
+        newLimits.pushBack(total);
+    }
+    newBegins.pushBack(total);
+
+    DSVector<Edge> newEdges;
+    newEdges.setCapacity(total);
+    for(int i = 0; i < total; i++){
+        newEdges.pushBack(Edge());
+    }
+
+    Edge* newEdgeData = newEdges.getData();
+    const int* newBeginData = newBegins.getData();
+    for(int airport = 0; airport < numAirports; airport++){
+        int start = newBeginData[airport];
+        for(int i = beginData[airport]; i < endData[airport]; i++){
+            newEdgeData[start++] = edgeData[i];
+        }
+    }
+
+    edges = newEdges;
+    numEdges = total;
+    abandonedEdges = 0;
+
+    if(slack){
+        newBegins.removeLast();
+        begins = newBegins;
+        ends = newEnds;
+        limits = newLimits;
+    } else {
+        // without slack the block starts are exactly the CSR offsets
+        offsets = newBegins;
+        begins.clear();
+        begins.shrink();
+        ends.clear();
+        ends.shrink();
+        limits.clear();
+        limits.shrink();
+        packed = true;
+    }
+
+    updateViews();
+}
+
+/**
+ * @brief compactIfSparse - repacks with slack once the slots left behind by moved blocks outnumber the live flights,
+ * so the cost of repacking is spread over at least as many moved flights
+ */
+void FlightNetwork::compactIfSparse()
+{
+    if(abandonedEdges > liveEdges && abandonedEdges > 1024){
+        repack(true);
+    }
+}
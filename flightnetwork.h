@@ -0,0 +1,236 @@
+#ifndef FLIGHTNETWORK_H
+#define FLIGHTNETWORK_H
+
+#include "DataStructures/DSVector/dsvector.h"
+
+/**
+ * @brief The FlightNetwork class - compressed sparse row graph of flights
+ *
+ * The outgoing flights of airport a are stored contiguously in edges[firstEdge(a)] up to edges[lastEdge(a)], so
+ * expanding an airport is a sequential scan of one array. A freshly built or attached network is packed, and
+ * lastEdge(a) is firstEdge(a + 1).
+ *
+ * Updates keep that layout. Adding a flight to an airport without room moves the airport's flights to a block with
+ * slack at the end of the edge array, and removing one closes the gap inside its block, so both cost O(degree). The
+ * slots left behind by moved blocks are reclaimed by repacking every block with some slack once they outnumber the
+ * live flights. Edge ids are only stable between updates.
+ */
+class FlightNetwork
+{
+public:
+    /**
+     * @brief The Edge struct - a single outgoing flight
+     */
+    struct Edge{
+        int dest;
+        int airline;
+        int time;
+        int cost;
+    };
+
+    /**
+     * @brief The Flight struct - a flight as read from the data file, before it is frozen
+     */
+    struct Flight{
+        int origin;
+        int dest;
+        int airline;
+        int time;
+        int cost;
+    };
+
+    /**
+     * @brief FlightNetwork - default constructor, creates an empty network
+     */
+    FlightNetwork();
+
+    /**
+     * @brief FlightNetwork - copy constructor
+     * @param other - network to copy
+     */
+    FlightNetwork(const FlightNetwork& other);
+
+    /**
+     * @brief operator = : sets this network equal to the given network, attached arrays are shared
+     * @param other - network to copy
+     * @return reference to this network
+     */
+    FlightNetwork& operator=(const FlightNetwork& other);
+
+    /**
+     * @brief build - replaces the network with the given flights
+     * @param numAirports - number of airports, every origin and dest must be below this
+     * @param flights - flights to store
+     */
+    void build(const int numAirports, const DSVector<Flight>& flights);
+
+    /**
+     * @brief attach - replaces the network with arrays owned by the caller, which must outlive the network
+     * @param numAirports - number of airports
+     * @param numEdges - number of flights
+     * @param offsets - numAirports + 1 offsets into edges
+     * @param edges - flights sorted by origin
+     */
+    void attach(const int numAirports, const int numEdges, const int* offsets, const Edge* edges);
+
+    /**
+     * @brief clear - removes all airports and flights
+     */
+    void clear();
+
+    /**
+     * @brief addEdge - adds an outgoing flight to an airport, adding airports up to origin and dest if needed
+     * @param origin - id of the airport the flight leaves
+     * @param edge - flight to add
+     */
+    void addEdge(const int origin, const Edge& edge);
+
+    /**
+     * @brief removeEdges - removes every flight from origin to dest on airline
+     * @param origin - id of the airport the flights leave
+     * @param dest - id of the airport the flights arrive at
+     * @param airline - id of the airline
+     * @return number of flights removed
+     */
+    int removeEdges(const int origin, const int dest, const int airline);
+
+    /**
+     * @brief updateEdges - sets the time and cost of every flight from origin to dest on airline
+     * @param origin - id of the airport the flights leave
+     * @param dest - id of the airport the flights arrive at
+     * @param airline - id of the airline
+     * @param time - new time of the flights
+     * @param cost - new cost of the flights
+     * @return number of flights updated
+     */
+    int updateEdges(const int origin, const int dest, const int airline, const int time, const int cost);
+
+    /**
+     * @brief compact - packs the flights back into a plain CSR layout, dropping abandoned slots and slack
+     */
+    void compact();
+
+    /**
+     * @brief isPacked - returns whether the flights are laid out in a plain CSR layout
+     * @return true if lastEdge(a) is firstEdge(a + 1) for every airport
+     */
+    bool isPacked() const;
+
+    /**
+     * @brief airportCount - returns the number of airports in the network
+     * @return number of airports
+     */
+    int airportCount() const;
+
+    /**
+     * @brief edgeCount - returns the number of edge ids, abandoned slots included
+     * @return one past the largest edge id
+     */
+    int edgeCount() const;
+
+    /**
+     * @brief changeCount - returns the number of times the flights or their layout changed, so a search can tell
+     * whether data it derived from the network is stale
+     * @return number of changes
+     */
+    int changeCount() const;
+
+    /**
+     * @brief firstEdge - returns the index of the first outgoing flight of an airport
+     * @param airport - id of the airport
+     * @return index of the first outgoing flight
+     */
+    int firstEdge(const int airport) const;
+
+    /**
+     * @brief lastEdge - returns the index one past the last outgoing flight of an airport
+     * @param airport - id of the airport
+     * @return index one past the last outgoing flight
+     */
+    int lastEdge(const int airport) const;
+
+    /**
+     * @brief getEdge - returns the flight at the given index
+     * @param index - index of the flight
+     * @return reference to the flight
+     */
+    const Edge& getEdge(const int index) const;
+
+    /**
+     * @brief getOffsets - returns the airportCount() + 1 offsets into the edge array of a packed network
+     * @return pointer to the offsets
+     */
+    const int* getOffsets() const;
+
+    /**
+     * @brief getEdges - returns the edge array, sorted by origin
+     * @return pointer to the edges
+     */
+    const Edge* getEdges() const;
+
+private:
+    DSVector<int> offsets;
+    DSVector<Edge> edges;
+
+    // block of each airport once the network has been updated, limits mark the end of each block's slack
+    DSVector<int> begins;
+    DSVector<int> ends;
+    DSVector<int> limits;
+
+    // arrays owned by the caller, nullptr unless attached
+    const int* attachedOffsets = nullptr;
+    const Edge* attachedEdges = nullptr;
+
+    // the arrays searched, pointing into the vectors above or the attached arrays
+    const int* beginView;
+    const int* endView;
+    const Edge* edgeView = nullptr;
+    int numAirports = 0;
+    int numEdges = 0;
+
+    // flights reachable through the blocks, and slots left behind when a block moved
+    int liveEdges = 0;
+    int abandonedEdges = 0;
+    bool packed = true;
+
+    // bumped by every change, never copied from another network
+    int numChanges = 0;
+
+    /**
+     * @brief updateViews - points the searched arrays at the current layout and counts a change
+     */
+    void updateViews();
+
+    /**
+     * @brief unpack - copies attached arrays and splits the offsets into per airport blocks so they can be updated
+     */
+    void unpack();
+
+    /**
+     * @brief hasEdge - returns whether an airport has a flight to dest on airline
+     * @param origin - id of the airport the flights leave
+     * @param dest - id of the airport the flights arrive at
+     * @param airline - id of the airline
+     * @return true if a matching flight exists
+     */
+    bool hasEdge(const int origin, const int dest, const int airline) const;
+
+    /**
+     * @brief addAirports - adds empty airports until the given id exists
+     * @param airport - id that must exist
+     */
+    void addAirports(const int airport);
+
+    /**
+     * @brief repack - copies every block into a new edge array without abandoned slots
+     * @param slack - whether each block keeps room to grow, otherwise the result is packed
+     */
+    void repack(const bool slack);
+
+    /**
+     * @brief compactIfSparse - repacks once abandoned slots outnumber the live flights
+     */
+    void compactIfSparse();
+};
+
+#endif // FLIGHTNETWORK_H
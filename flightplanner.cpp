@@ -1,4 +1,15 @@
 #include "flightplanner.h"
+#include "branchboundsearch.h"
+#include "kshortestpaths.h"
+#include "paretosearch.h"
+#include "mappedfile.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <vector>
 
 /**
  * @brief FlightPlanner - default constructor
@@ -6,60 +17,759 @@
 FlightPlanner::FlightPlanner() {}
 
 /**
- * @brief createFlightList - Creates adjacency list using the data from the given file
+ * @brief createFlightList - maps the given file and reads every flight straight from its bytes into the flight
+ * network, each line is a route flown in both directions. Fields are hashed and parsed in place, so a line only
+ * allocates when it introduces a new airport or airline
  * @param dataFile - file containing flight data
+ * @return false if the file could not be opened, the network is left unchanged
+ */
+bool FlightPlanner::createFlightList(const DSString& dataFile)
+{
+    MappedFile file;
+
+    if(!file.open(dataFile)){
+        std::cerr << "Could not open flight data file: " << dataFile << std::endl;
+        return false;
+    }
+
+    airports.clear();
+    airlines.clear();
+    cache.clear();
+
+    DSStringView rest(file.data(), file.size());
+    DSStringView line;
+    DSStringView fields[5];
+
+    int numLines = 0;
+    if(rest.nextLine(line) && line.split(fields, 1) == 1){
+        numLines = fields[0].toInt();
+    }
+
+    DSVector<FlightNetwork::Flight> flightData;
+    flightData.reserve(numLines * 2);
+
+    for(int i = 0; i < numLines && rest.nextLine(line); i++){
+        if(line.split(fields, 5) < 5){
+            continue;
+        }
+
+        FlightNetwork::Flight flight;
+        flight.origin = airports.intern(fields[0]);
+        flight.dest = airports.intern(fields[1]);
+        flight.time = fields[2].toInt();
+        flight.cost = fields[3].toInt();
+        flight.airline = airlines.intern(fields[4]);
+        flightData.pushBack(flight);
+
+        FlightNetwork::Flight reverse = flight;
+        reverse.origin = flight.dest;
+        reverse.dest = flight.origin;
+        flightData.pushBack(reverse);
+    }
+
+    flights.build(airports.size(), flightData);
+    network.close();
+
+    return true;
+}
+
+/**
+ * @brief loadNetwork - maps a compiled network and searches its arrays directly, nothing is parsed and nothing is
+ * allocated per flight
+ * @param networkFile - path to the compiled network
+ * @return false if the file is missing, corrupt or from another version
+ */
+bool FlightPlanner::loadNetwork(const DSString& networkFile)
+{
+    cache.clear();
+    flights.clear();
+
+    if(!network.open(networkFile)){
+        std::cerr << "Could not load compiled network: " << networkFile << std::endl;
+        airports.clear();
+        airlines.clear();
+        return false;
+    }
+
+    if(!network.attachTo(flights, airports, airlines)){
+        std::cerr << "Could not load compiled network: " << networkFile << std::endl;
+        network.close();
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief compileNetwork - writes the current flight network to a file loadNetwork can map
+ * @param networkFile - path of the file to write
+ * @return true if the file was written
+ */
+bool FlightPlanner::compileNetwork(const DSString& networkFile) const
+{
+    // the file stores a plain CSR layout, so an updated network is written from a packed copy
+    bool written;
+    if(flights.isPacked()){
+        written = NetworkFile::write(networkFile, flights, airports, airlines);
+    } else {
+        FlightNetwork packed = flights;
+        packed.compact();
+        written = NetworkFile::write(networkFile, packed, airports, airlines);
+    }
+
+    if(!written){
+        std::cerr << "Could not write compiled network: " << networkFile << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief addFlight - adds both directions of the route to the network in O(degree), new names get new ids
+ * @param origin - name of one end of the route
+ * @param dest - name of the other end of the route
+ * @param time - time of the flight
+ * @param cost - cost of the flight
+ * @param airline - name of the airline
  */
-void FlightPlanner::createFlightList(const DSString dataFile)
+void FlightPlanner::addFlight(const DSStringView& origin, const DSStringView& dest, const int time, const int cost, const DSStringView& airline)
 {
-    //set flights adjacency list
+    FlightNetwork::Edge edge;
+    edge.airline = airlines.intern(airline);
+    edge.time = time;
+    edge.cost = cost;
+
+    int originId = airports.intern(origin);
+    int destId = airports.intern(dest);
+
+    edge.dest = destId;
+    flights.addEdge(originId, edge);
+
+    edge.dest = originId;
+    flights.addEdge(destId, edge);
+
+    cache.clear();
 }
 
 /**
- * @brief planFlights - iterate through the given file and find the fastest or cheapest 3 fligt paths for each plan
+ * @brief cancelFlight - removes both directions of the route, names that were never loaded match nothing
+ * @param origin - name of one end of the route
+ * @param dest - name of the other end of the route
+ * @param airline - name of the airline
+ * @return number of flights removed, counting each direction
+ */
+int FlightPlanner::cancelFlight(const DSStringView& origin, const DSStringView& dest, const DSStringView& airline)
+{
+    int originId = airports.find(origin);
+    int destId = airports.find(dest);
+    int airlineId = airlines.find(airline);
+
+    if(originId == -1 || destId == -1 || airlineId == -1){
+        return 0;
+    }
+
+    int removed = flights.removeEdges(originId, destId, airlineId) + flights.removeEdges(destId, originId, airlineId);
+    if(removed > 0){
+        cache.clear();
+    }
+
+    return removed;
+}
+
+/**
+ * @brief repriceFlight - overwrites both directions of the route in place
+ * @param origin - name of one end of the route
+ * @param dest - name of the other end of the route
+ * @param time - new time of the flights
+ * @param cost - new cost of the flights
+ * @param airline - name of the airline
+ * @return number of flights updated, counting each direction
+ */
+int FlightPlanner::repriceFlight(const DSStringView& origin, const DSStringView& dest, const int time, const int cost, const DSStringView& airline)
+{
+    int originId = airports.find(origin);
+    int destId = airports.find(dest);
+    int airlineId = airlines.find(airline);
+
+    if(originId == -1 || destId == -1 || airlineId == -1){
+        return 0;
+    }
+
+    int updated = flights.updateEdges(originId, destId, airlineId, time, cost)
+                  + flights.updateEdges(destId, originId, airlineId, time, cost);
+    if(updated > 0){
+        cache.clear();
+    }
+
+    return updated;
+}
+
+/**
+ * @brief planFlights - iterate through the given file and find the fastest or cheapest 3 fligt paths for each plan,
+ * the file is mapped and each request is read in place, so only cities seen for the first time allocate
  * @param plansFile - a ptah to the file containing the flight plans
  * @param outputFile - file to output the best flights
+ * @return false if the plans file could not be read or the output file could not be written
  */
-void FlightPlanner::planFlights(const DSString plansFile, const DSString outputFile)
+bool FlightPlanner::planFlights(const DSString& plansFile, const DSString& outputFile)
 {
-    // read plansFile
+    MappedFile file;
+
+    if(!file.open(plansFile)){
+        std::cerr << "Could not open flight plans file: " << plansFile << std::endl;
+        return false;
+    }
 
-    // call cheapestFlightPaths or fastestFlightPaths for each line
+    DSStringView rest(file.data(), file.size());
+    DSStringView line;
+    DSStringView fields[3];
 
-    // call writeToFile
+    int numLines = 0;
+    if(rest.nextLine(line) && line.split(fields, 1) == 1){
+        numLines = fields[0].toInt();
+    }
+
+    DSVector<Request> requests;
+    requests.reserve(numLines);
+    for(int i = 0; i < numLines && rest.nextLine(line); i++){
+        if(line.split(fields, 3) < 3){
+            continue;
+        }
+
+        Request request;
+        request.start = airports.intern(fields[0]);
+        request.end = airports.intern(fields[1]);
+        request.mode = fields[2][0];
+        requests.pushBack(request);
+    }
+
+    DSVector<DSVector<Plan>> plans = planRequests(requests);
+
+    return writeToFile(requests, plans, outputFile);
 }
 
 /**
- * @brief cheapestFlightPaths - iterates through all possible paths and outputs the fastest 3
- * @param start - starting city
- * @param end - ending city
- * @return a vector containing the cheapest 3 paths
+ * @brief createSearch - returns the searches of every engine over the flight network with the planner's
+ * penalties, none of them allocates before its first search
+ * @return searches that can be reused across calls to planRoute
  */
-DSVector<FlightPlanner::Plan> FlightPlanner::cheapestFlightPaths(const DSString start, const DSString end)
+FlightPlanner::RouteSearch FlightPlanner::createSearch() const
 {
-    // try all paths between start and end and output a list of the top 3 cheapest fligts
+    return RouteSearch{ParetoSearch(flights, getPenalties(), NUM_PLANS), KShortestPaths(flights, getPenalties()),
+                       BranchBoundSearch(flights, getPenalties())};
+}
 
-    return DSVector<Plan>();
+/**
+ * @brief planRoute - looks the cities up without interning them, then answers from the cache or one search
+ * @param start - name of the starting city
+ * @param end - name of the ending city
+ * @param mode - 'C' to rank by cost, otherwise by time
+ * @param search - searches to run with the planner's engine, one per thread
+ * @return the best 3 paths, empty if there are none
+ */
+DSVector<FlightPlanner::Plan> FlightPlanner::planRoute(const DSStringView& start, const DSStringView& end, const char mode, RouteSearch& search)
+{
+    Request request;
+    request.start = airports.find(start);
+    request.end = airports.find(end);
+    request.mode = mode;
+
+    DSVector<Plan> plans;
+    if(request.start == -1 || request.end == -1 || request.start >= flights.airportCount()
+            || request.end >= flights.airportCount() || request.start == request.end){
+        return plans;
+    }
+
+    FlightSearch::Objective objective = requestObjective(request);
+    if(engine != PARETO){
+        return bestFlightPaths(request.start, request.end, objective, search);
+    }
+
+    if(cache.get(cacheKey(request.start, request.end, objective), plans)){
+        return plans;
+    }
+
+    search.pareto.search(request.start, request.end);
+
+    plans = toPlans(request.start, search.pareto.bestPaths(request.end, objective));
+    cache.put(cacheKey(request.start, request.end, objective), plans, planBytes(plans));
+
+    return plans;
 }
 
 /**
- * @brief fastestFlightPaths - iterates through all possible paths and outputs the fastest 3
- * @param start - starting city
- * @param end - ending city
- * @return a vector containing the fastest 3 paths
+ * @brief setThreadCount - sets the number of threads planFlights searches with
+ * @param numThreads - number of threads, 0 uses one per hardware thread
  */
-DSVector<FlightPlanner::Plan> FlightPlanner::fastestFlightPaths(const DSString start, const DSString end)
+void FlightPlanner::setThreadCount(const int numThreads)
 {
-    // try all paths between start and end and output a list of the top 3 fastest fligts
+    if(numThreads > 0){
+        this->numThreads = numThreads;
+    } else {
+        this->numThreads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+    }
+}
 
-    return DSVector<Plan>();
+/**
+ * @brief setEngine - sets the search planFlights and planRoute answer requests with
+ * @param engine - search to use
+ */
+void FlightPlanner::setEngine(const Engine engine)
+{
+    this->engine = engine;
 }
 
 /**
- * @brief writeToFile - outputs the given flight paths to the given file
- * @param paths - flight paths to output
+ * @brief planRequests - buckets the requests by starting city and runs one search per starting city towards every
+ * ending city requested from it, then reads each request's plans from that search. Workers claim the next unsearched
+ * starting city until none are left and store plans by request index, so the output order never depends on timing.
+ * The per request engines run one search for each request of the bucket instead. Every request looks the cache up
+ * exactly once, and a search repeated in the batch only runs for its first occurrence
+ * @param requests - requests to plan
+ * @return plans for each request, in request order
+ */
+DSVector<DSVector<FlightPlanner::Plan>> FlightPlanner::planRequests(const DSVector<Request>& requests)
+{
+    DSVector<DSVector<int>> byStart;
+    byStart.setCapacity(flights.airportCount());
+    for(int i = 0; i < flights.airportCount(); i++){
+        byStart.pushBack(DSVector<int>());
+    }
+
+    DSVector<DSVector<Plan>> plans;
+    const Request* requestData = requests.getData();
+
+    // first uncached occurrence of every search, later occurrences are looked up once the searches are done
+    DSHashMap<PlanCache::Key, int, PlanCache::KeyHash> pending;
+    DSVector<int> repeats;
+
+    for(int i = 0; i < requests.getNumIndexes(); i++){
+        const Request& request = requestData[i];
+        plans.pushBack(DSVector<Plan>());
+
+        // cities that were only seen in the plans file have no flights
+        if(request.start >= flights.airportCount() || request.end >= flights.airportCount() || request.start == request.end){
+            continue;
+        }
+
+        PlanCache::Key key = cacheKey(request.start, request.end, requestObjective(request));
+        if(pending.contains(key)){
+            repeats.pushBack(i);
+        } else if(!cache.get(key, plans.back())){
+            pending.insert(key, i);
+            byStart.getData()[request.start].pushBack(i);
+        }
+    }
+
+    DSVector<int> starts;
+    for(int start = 0; start < flights.airportCount(); start++){
+        if(byStart.getData()[start].getNumIndexes() > 0){
+            starts.pushBack(start);
+        }
+    }
+
+#ifdef FLIGHTPLANNER_STATS
+    statsRequests = requests;
+    requestSearches.clear();
+    requestSearches.setCapacity(requests.getNumIndexes());
+    for(int i = 0; i < requests.getNumIndexes(); i++){
+        requestSearches.pushBack(-1);
+    }
+    searchStats.clear();
+    searchStats.setCapacity(starts.getNumIndexes());
+    for(int i = 0; i < starts.getNumIndexes(); i++){
+        searchStats.pushBack(SearchStats());
+    }
+#endif
+
+    DSVector<Plan>* planData = plans.getData();
+    std::atomic<int> nextStart(0);
+
+    auto worker = [&](){
+        RouteSearch search = createSearch();
+
+        for(int i = nextStart++; i < starts.getNumIndexes(); i = nextStart++){
+            int start = starts.getData()[i];
+            const DSVector<int>& bucket = byStart.getData()[start];
+
+            if(engine != PARETO){
+                for(int j = 0; j < bucket.getNumIndexes(); j++){
+                    const Request& request = requestData[bucket.getData()[j]];
+                    SEARCH_STAT(requestSearches.getData()[bucket.getData()[j]] = i);
+                    FlightSearch::Objective objective = requestObjective(request);
+                    DSVector<Plan>& result = planData[bucket.getData()[j]];
+
+                    if(engine == BRANCH_BOUND){
+                        result = toPlans(start, search.branchBound.find(start, request.end, objective, NUM_PLANS));
+                        SEARCH_STAT(searchStats.getData()[i].add(search.branchBound.getStats()));
+                    } else {
+                        result = toPlans(start, search.kShortest.find(start, request.end, objective, NUM_PLANS));
+                        SEARCH_STAT(searchStats.getData()[i].add(search.kShortest.getStats()));
+                    }
+                    cache.put(cacheKey(start, request.end, objective), result, planBytes(result));
+                }
+
+                continue;
+            }
+
+            DSVector<int> ends;
+            for(int j = 0; j < bucket.getNumIndexes(); j++){
+                ends.pushBack(requestData[bucket.getData()[j]].end);
+            }
+
+            search.pareto.search(start, ends);
+            SEARCH_STAT(searchStats.getData()[i] = search.pareto.getStats());
+
+            for(int j = 0; j < bucket.getNumIndexes(); j++){
+                const Request& request = requestData[bucket.getData()[j]];
+                SEARCH_STAT(requestSearches.getData()[bucket.getData()[j]] = i);
+                FlightSearch::Objective objective = requestObjective(request);
+                DSVector<Plan>& result = planData[bucket.getData()[j]];
+
+                result = toPlans(start, search.pareto.bestPaths(request.end, objective));
+                cache.put(cacheKey(start, request.end, objective), result, planBytes(result));
+            }
+        }
+    };
+
+    int numWorkers = numThreads < starts.getNumIndexes() ? numThreads : starts.getNumIndexes();
+
+    std::vector<std::thread> threads;
+    for(int i = 1; i < numWorkers; i++){
+        threads.emplace_back(worker);
+    }
+    worker();
+    for(auto& thread : threads){
+        thread.join();
+    }
+
+    // a repeat counts as a hit the way it would if the requests were answered one by one, and falls back to its
+    // first occurrence if the cache could not keep the plans
+    for(int i = 0; i < repeats.getNumIndexes(); i++){
+        const Request& request = requestData[repeats.getData()[i]];
+        PlanCache::Key key = cacheKey(request.start, request.end, requestObjective(request));
+        DSVector<Plan>& result = planData[repeats.getData()[i]];
+
+        if(!cache.get(key, result)){
+            result = planData[*pending.find(key)];
+        }
+    }
+
+    return plans;
+}
+
+/**
+ * @brief requestObjective - returns the criterion a request asks to minimise
+ * @param request - request from the plans file
+ * @return COST for 'C' requests, TIME otherwise
+ */
+FlightSearch::Objective FlightPlanner::requestObjective(const Request& request) const
+{
+    return request.mode == 'C' ? FlightSearch::COST : FlightSearch::TIME;
+}
+
+/**
+ * @brief bestFlightPaths - runs the branch and bound search if it is the engine and the k shortest paths search
+ * otherwise, cities that were only seen in the plans file have no flights
+ * @param start - id of the starting city
+ * @param end - id of the ending city
+ * @param objective - criterion to minimise
+ * @param search - searches of the calling thread
+ * @return a vector containing the best 3 paths
+ */
+DSVector<FlightPlanner::Plan> FlightPlanner::bestFlightPaths(const int start, const int end, const FlightSearch::Objective objective, RouteSearch& search)
+{
+    if(start >= flights.airportCount() || end >= flights.airportCount()){
+        return DSVector<Plan>();
+    }
+
+    DSVector<Plan> plans;
+    if(cache.get(cacheKey(start, end, objective), plans)){
+        return plans;
+    }
+
+    if(engine == BRANCH_BOUND){
+        plans = toPlans(start, search.branchBound.find(start, end, objective, NUM_PLANS));
+    } else {
+        plans = toPlans(start, search.kShortest.find(start, end, objective, NUM_PLANS));
+    }
+    cache.put(cacheKey(start, end, objective), plans, planBytes(plans));
+
+    return plans;
+}
+
+/**
+ * @brief setCacheSize - sets the memory the result cache may use
+ * @param maxBytes - memory cap in bytes, 0 disables the cache
+ */
+void FlightPlanner::setCacheSize(const size_t maxBytes)
+{
+    cache.setMaxBytes(maxBytes);
+}
+
+/**
+ * @brief getCacheStats - returns the hit, miss and eviction counters of the result cache
+ * @return cache counters
+ */
+FlightPlanner::PlanCache::Stats FlightPlanner::getCacheStats() const
+{
+    return cache.getStats();
+}
+
+/**
+ * @brief writeStats - writes one row per request with the counters of the search that answered it, where shared is
+ * the number of requests that search answered, then the totals over every search run
+ * @param statsFile - file to write, JSON if it ends in .json and CSV otherwise
+ * @return false if the file could not be written or the build does not count search work
+ */
+bool FlightPlanner::writeStats(const DSString& statsFile) const
+{
+#ifndef FLIGHTPLANNER_STATS
+    (void)statsFile;
+    std::cerr << "Search statistics are not compiled in, rebuild with FLIGHTPLANNER_STATS enabled" << std::endl;
+    return false;
+#else
+    std::ofstream file(statsFile.c_str());
+
+    if(!file.is_open()){
+        std::cerr << "Could not open statistics file: " << statsFile << std::endl;
+        return false;
+    }
+
+    bool json = statsFile.size() >= 5 && std::strcmp(statsFile.c_str() + statsFile.size() - 5, ".json") == 0;
+
+    const Request* requestData = statsRequests.getData();
+    const int* searchData = requestSearches.getData();
+    const SearchStats* statsData = searchStats.getData();
+
+    DSVector<int> shared;
+    for(int i = 0; i < searchStats.getNumIndexes(); i++){
+        shared.pushBack(0);
+    }
+    for(int i = 0; i < requestSearches.getNumIndexes(); i++){
+        if(searchData[i] != -1){
+            shared.getData()[searchData[i]]++;
+        }
+    }
+
+    SearchStats total;
+    double maxSeconds = 0;
+    for(int i = 0; i < searchStats.getNumIndexes(); i++){
+        total.add(statsData[i]);
+        if(statsData[i].seconds > maxSeconds){
+            maxSeconds = statsData[i].seconds;
+        }
+    }
+
+    // writes the counters of a search as the last fields of a row
+    auto writeCounters = [&](const SearchStats& stats){
+        if(json){
+            file << "\"settled\": " << stats.settled << ", \"relaxed\": " << stats.relaxed << ", \"pruned\": " << stats.pruned
+                 << ", \"peak_frontier\": " << stats.peakFrontier << ", \"bytes\": " << stats.bytes
+                 << ", \"wall_us\": " << stats.seconds * 1e6;
+        } else {
+            file << stats.settled << "," << stats.relaxed << "," << stats.pruned << "," << stats.peakFrontier << ","
+                 << stats.bytes << "," << stats.seconds * 1e6;
+        }
+    };
+
+    if(json){
+        file << "{\n  \"requests\": [\n";
+    } else {
+        file << "request,start,end,mode,search,shared,settled,relaxed,pruned,peak_frontier,bytes,wall_us\n";
+    }
+
+    for(int i = 0; i < statsRequests.getNumIndexes(); i++){
+        const Request& request = requestData[i];
+        int search = searchData[i];
+        SearchStats stats = search == -1 ? SearchStats() : statsData[search];
+
+        if(json){
+            file << "    {\"request\": " << i + 1 << ", \"start\": \"" << airports.getName(request.start)
+                 << "\", \"end\": \"" << airports.getName(request.end) << "\", \"mode\": \"" << request.mode
+                 << "\", \"search\": " << search << ", \"shared\": " << (search == -1 ? 0 : shared.getData()[search]) << ", ";
+            writeCounters(stats);
+            file << "}" << (i + 1 < statsRequests.getNumIndexes() ? "," : "") << "\n";
+        } else {
+            file << i + 1 << "," << airports.getName(request.start) << "," << airports.getName(request.end) << ","
+                 << request.mode << "," << search << "," << (search == -1 ? 0 : shared.getData()[search]) << ",";
+            writeCounters(stats);
+            file << "\n";
+        }
+    }
+
+    if(json){
+        file << "  ],\n  \"total\": {\"requests\": " << statsRequests.getNumIndexes() << ", \"searches\": "
+             << searchStats.getNumIndexes() << ", ";
+        writeCounters(total);
+        file << ", \"max_wall_us\": " << maxSeconds * 1e6 << "}\n}\n";
+    } else {
+        // the totals row names the number of requests and searches in place of the cities
+        file << "total," << statsRequests.getNumIndexes() << "," << searchStats.getNumIndexes() << ",,,,";
+        writeCounters(total);
+        file << "\n";
+    }
+
+    return !file.fail();
+#endif
+}
+
+/**
+ * @brief cacheKey - builds the result cache key of a search
+ * @param start - id of the starting city
+ * @param end - id of the ending city
+ * @param objective - criterion minimised
+ * @return key of the search
+ */
+FlightPlanner::PlanCache::Key FlightPlanner::cacheKey(const int start, const int end, const FlightSearch::Objective objective) const
+{
+    PlanCache::Key key;
+    key.start = start;
+    key.end = end;
+    key.objective = objective;
+    key.k = NUM_PLANS;
+
+    return key;
+}
+
+/**
+ * @brief planBytes - estimates the memory held by a vector of plans
+ * @param plans - plans to measure
+ * @return size in bytes
+ */
+size_t FlightPlanner::planBytes(const DSVector<Plan>& plans) const
+{
+    size_t bytes = sizeof(DSVector<Plan>) + plans.getCapacity() * sizeof(Plan);
+
+    const Plan* planData = plans.getData();
+    for(int i = 0; i < plans.getNumIndexes(); i++){
+        bytes += planData[i].path.getCapacity() * sizeof(City);
+    }
+
+    return bytes;
+}
+
+/**
+ * @brief getPenalties - returns the connection penalties used by the searches
+ * @return penalties between connecting flights
+ */
+FlightSearch::Penalties FlightPlanner::getPenalties() const
+{
+    FlightSearch::Penalties penalties;
+    penalties.layoverTime = LAYOVER_TIME;
+    penalties.layoverCost = LAYOVER_COST;
+    penalties.airlineChangeTime = AIRLINE_CHANGE_TIME;
+    penalties.airlineChangeCost = AIRLINE_CHANGE_COST;
+
+    return penalties;
+}
+
+/**
+ * @brief toPlans - converts search paths into plans, the first city of each plan is the starting city
+ * @param start - id of the starting city
+ * @param paths - paths found by a search
+ * @return plans with one city per stop
+ */
+DSVector<FlightPlanner::Plan> FlightPlanner::toPlans(const int start, const DSVector<FlightSearch::Path>& paths) const
+{
+    DSVector<Plan> plans;
+    plans.reserve(paths.getNumIndexes());
+    const FlightSearch::Path* pathData = paths.getData();
+
+    for(int i = 0; i < paths.getNumIndexes(); i++){
+        const int* edgeData = pathData[i].edges.getData();
+
+        Plan plan;
+        plan.totalTime = pathData[i].totalTime;
+        plan.totalCost = pathData[i].totalCost;
+        plan.path.reserve(pathData[i].edges.getNumIndexes() + 1);
+
+        City city;
+        city.id = start;
+        city.airline = -1;
+        city.time = 0;
+        city.cost = 0;
+        plan.path.pushBack(city);
+
+        for(int j = 0; j < pathData[i].edges.getNumIndexes(); j++){
+            const FlightNetwork::Edge& edge = flights.getEdge(edgeData[j]);
+
+            city.id = edge.dest;
+            city.airline = edge.airline;
+            city.time = edge.time;
+            city.cost = edge.cost;
+            plan.path.pushBack(city);
+        }
+
+        plans.pushBack(std::move(plan));
+    }
+
+    return plans;
+}
+
+/**
+ * @brief writeToFile - writes every itinerary of every request, resolving airport and airline ids to names
+ * @param requests - requests the paths were planned for
+ * @param paths - flight paths to output, one vector per request
  * @param filePath - path to the output file
+ * @return false if the file could not be opened or written
+ */
+bool FlightPlanner::writeToFile(const DSVector<Request>& requests, const DSVector<DSVector<Plan>>& paths, const DSString& filePath) const
+{
+    std::ofstream file(filePath.c_str());
+
+    if(!file.is_open()){
+        std::cerr << "Could not open output file: " << filePath << std::endl;
+        return false;
+    }
+
+    const Request* requestData = requests.getData();
+    const DSVector<Plan>* pathData = paths.getData();
+
+    for(int i = 0; i < requests.getNumIndexes(); i++){
+        const Request& request = requestData[i];
+
+        writePlans(file, i + 1, airports.getName(request.start), airports.getName(request.end), request.mode, pathData[i]);
+    }
+
+    file.flush();
+    if(file.fail()){
+        std::cerr << "Could not write output file: " << filePath << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief writePlans - outputs the request line, then every itinerary with one line per flight and its totals
+ * @param out - stream to write to
+ * @param number - number of the request
+ * @param start - name of the starting city
+ * @param end - name of the ending city
+ * @param mode - 'C' for a cost request, otherwise time
+ * @param plans - flight paths found for the request
  */
-void FlightPlanner::writeToFile(const DSVector<DSVector<Plan>> plans, const DSString path) const
+void FlightPlanner::writePlans(std::ostream& out, const int number, const DSStringView& start, const DSStringView& end, const char mode,
+                               const DSVector<Plan>& plans) const
 {
-    // write plans to file
+    out << "Flight " << number << ": " << start << ", " << end << (mode == 'C' ? " (Cost)" : " (Time)") << "\n";
+
+    if(plans.getNumIndexes() == 0){
+        out << "  No flight plan found\n";
+    }
+
+    const Plan* planData = plans.getData();
+    for(int j = 0; j < plans.getNumIndexes(); j++){
+        const City* cityData = planData[j].path.getData();
+
+        out << "  Itinerary " << j + 1 << ":\n";
+        for(int k = 1; k < planData[j].path.getNumIndexes(); k++){
+            out << "    " << airports.getName(cityData[k - 1].id) << " -> " << airports.getName(cityData[k].id)
+                << " (" << airlines.getName(cityData[k].airline) << ")\n";
+        }
+        out << "    Totals for Itinerary " << j + 1 << ":  Time: " << planData[j].totalTime
+            << " Cost: " << planData[j].totalCost << "\n";
+    }
 }
@@ -1,43 +1,200 @@
 #ifndef FLIGHTPLANNER_H
 #define FLIGHTPLANNER_H
 
+#include <ostream>
+
 #include "DataStructures/DSString/dsstring.h"
+#include "DataStructures/DSStringView/dsstringview.h"
 #include "DataStructures/DSVector/dsvector.h"
-#include "DataStructures/DSAdjList/dsadjlist.h"
+#include "flightnetwork.h"
+#include "nametable.h"
+#include "flightsearch.h"
+#include "branchboundsearch.h"
+#include "kshortestpaths.h"
+#include "paretosearch.h"
+#include "resultcache.h"
+#include "searchstats.h"
+#include "networkfile.h"
 
 class FlightPlanner
 {
 public:
+    /**
+     * @brief The City struct - a stop on a path, reached by a flight on airline, -1 for the starting city
+     */
     struct City{
-        DSString name;
-        DSString airline;
+        int id;
+        int airline;
         int time;
         int cost;
     };
 
+    /**
+     * @brief The Plan struct - a path through the network and its totals
+     */
     struct Plan{
         DSVector<City> path;
         int totalTime;
         int totalCost;
     };
 
+    /**
+     * @brief The Request struct - a line of the plans file, mode is 'T' for time or 'C' for cost
+     */
+    struct Request{
+        int start;
+        int end;
+        char mode;
+    };
+
+    /**
+     * @brief The Engine enum - search that answers requests, every engine returns the same plans
+     */
+    enum Engine{
+        // one bi-criteria search per starting city, answering all of its requests at once
+        PARETO,
+        // Yen's k shortest loopless paths per request
+        K_SHORTEST,
+        // depth first enumeration per request, pruned against the best 3 found so far
+        BRANCH_BOUND
+    };
+
+    /**
+     * @brief The RouteSearch struct - a search of every engine over the planner's network, owned by one thread or
+     * connection and reused across its requests so no engine is set up again per request
+     */
+    struct RouteSearch{
+        ParetoSearch pareto;
+        KShortestPaths kShortest;
+        BranchBoundSearch branchBound;
+    };
+
+    typedef ResultCache<DSVector<Plan>> PlanCache;
+
     /**
      * @brief FlightPlanner - default constructor
      */
     FlightPlanner();
 
     /**
-     * @brief createFlightList - Creates adjacency list using the data from the given file
+     * @brief createFlightList - Creates the flight network using the data from the given file
      * @param dataFile - file containing flight data
+     * @return false if the file could not be opened
+     */
+    bool createFlightList(const DSString& dataFile);
+
+    /**
+     * @brief loadNetwork - uses a network compiled by compileNetwork in place of a flight data file
+     * @param networkFile - path to the compiled network
+     * @return false if the file is missing, corrupt or from another version
+     */
+    bool loadNetwork(const DSString& networkFile);
+
+    /**
+     * @brief compileNetwork - writes the current flight network to a file loadNetwork can map
+     * @param networkFile - path of the file to write
+     * @return true if the file was written
+     */
+    bool compileNetwork(const DSString& networkFile) const;
+
+    /**
+     * @brief addFlight - adds a route flown in both directions to the loaded network
+     * @param origin - name of one end of the route
+     * @param dest - name of the other end of the route
+     * @param time - time of the flight
+     * @param cost - cost of the flight
+     * @param airline - name of the airline
+     */
+    void addFlight(const DSStringView& origin, const DSStringView& dest, const int time, const int cost, const DSStringView& airline);
+
+    /**
+     * @brief cancelFlight - removes every flight of an airline on a route, in both directions
+     * @param origin - name of one end of the route
+     * @param dest - name of the other end of the route
+     * @param airline - name of the airline
+     * @return number of flights removed, counting each direction
      */
-    void createFlightList(const DSString dataFile);
+    int cancelFlight(const DSStringView& origin, const DSStringView& dest, const DSStringView& airline);
+
+    /**
+     * @brief repriceFlight - sets the time and cost of every flight of an airline on a route, in both directions
+     * @param origin - name of one end of the route
+     * @param dest - name of the other end of the route
+     * @param time - new time of the flights
+     * @param cost - new cost of the flights
+     * @param airline - name of the airline
+     * @return number of flights updated, counting each direction
+     */
+    int repriceFlight(const DSStringView& origin, const DSStringView& dest, const int time, const int cost, const DSStringView& airline);
 
     /**
      * @brief planFlights - outputs the best 3 flight paths for each plan in the given plans file
      * @param plansFile - a ptah to the file containing the flight plans
      * @param outputFile - file to output the best flights
+     * @return false if the plans file could not be read or the output file could not be written
+     */
+    bool planFlights(const DSString& plansFile, const DSString& outputFile);
+
+    /**
+     * @brief createSearch - returns the searches of every engine over the flight network with the planner's
+     * penalties, for planRoute
+     * @return searches that can be reused across calls to planRoute
      */
-    void planFlights(const DSString plansFile, const DSString outputFile);
+    RouteSearch createSearch() const;
+
+    /**
+     * @brief planRoute - finds the best 3 flight paths between two cities without changing the planner, so several
+     * threads may call it at once as long as none updates the network
+     * @param start - name of the starting city
+     * @param end - name of the ending city
+     * @param mode - 'C' to rank by cost, otherwise by time
+     * @param search - searches to run with the planner's engine, one per thread
+     * @return the best 3 paths, empty if there are none
+     */
+    DSVector<Plan> planRoute(const DSStringView& start, const DSStringView& end, const char mode, RouteSearch& search);
+
+    /**
+     * @brief writePlans - outputs one request and its flight paths in the format of the output file
+     * @param out - stream to write to
+     * @param number - number of the request
+     * @param start - name of the starting city
+     * @param end - name of the ending city
+     * @param mode - 'C' for a cost request, otherwise time
+     * @param plans - flight paths found for the request
+     */
+    void writePlans(std::ostream& out, const int number, const DSStringView& start, const DSStringView& end, const char mode,
+                    const DSVector<Plan>& plans) const;
+
+    /**
+     * @brief setThreadCount - sets the number of threads planFlights searches with
+     * @param numThreads - number of threads, 0 uses one per hardware thread
+     */
+    void setThreadCount(const int numThreads);
+
+    /**
+     * @brief setEngine - sets the search planFlights and planRoute answer requests with
+     * @param engine - search to use
+     */
+    void setEngine(const Engine engine);
+
+    /**
+     * @brief setCacheSize - sets the memory the result cache may use
+     * @param maxBytes - memory cap in bytes, 0 disables the cache
+     */
+    void setCacheSize(const size_t maxBytes);
+
+    /**
+     * @brief getCacheStats - returns the hit, miss and eviction counters of the result cache
+     * @return cache counters
+     */
+    PlanCache::Stats getCacheStats() const;
+
+    /**
+     * @brief writeStats - writes the search counters of the last planFlights per request and in total
+     * @param statsFile - file to write, JSON if it ends in .json and CSV otherwise
+     * @return false if the file could not be written or the build does not count search work
+     */
+    bool writeStats(const DSString& statsFile) const;
 
 private:
     const int LAYOVER_TIME = 43;
@@ -46,30 +203,91 @@ private:
     const int AIRLINE_CHANGE_TIME = 22;
     const int AIRLINE_CHANGE_COST = 0;
 
-    DSAdjList<City> flights;
+    const int NUM_PLANS = 3;
+
+    int numThreads = 1;
+
+    Engine engine = PARETO;
+
+    // results of earlier searches, cleared whenever the network changes
+    PlanCache cache;
+
+    FlightNetwork flights;
+
+    // mapped arrays flights is attached to after loadNetwork
+    NetworkFile network;
+
+    // requests of the last planFlights, the search that answered each one or -1 if it was cached, and the counters
+    // of every search, only filled when built with FLIGHTPLANNER_STATS
+    DSVector<Request> statsRequests;
+    DSVector<int> requestSearches;
+    DSVector<SearchStats> searchStats;
+
+    NameTable airports;
+    NameTable airlines;
+
+    /**
+     * @brief planRequests - finds the best 3 flight paths for every request
+     * @param requests - requests to plan
+     * @return plans for each request, in request order
+     */
+    DSVector<DSVector<Plan>> planRequests(const DSVector<Request>& requests);
+
+    /**
+     * @brief requestObjective - returns the criterion a request asks to minimise
+     * @param request - request from the plans file
+     * @return COST for 'C' requests, TIME otherwise
+     */
+    FlightSearch::Objective requestObjective(const Request& request) const;
+
+    /**
+     * @brief bestFlightPaths - returns the best 3 flight paths between the given cities for an objective
+     * @param start - id of the starting city
+     * @param end - id of the ending city
+     * @param objective - criterion to minimise
+     * @param search - searches of the calling thread
+     * @return a vector containing the best 3 paths
+     */
+    DSVector<Plan> bestFlightPaths(const int start, const int end, const FlightSearch::Objective objective, RouteSearch& search);
+
+    /**
+     * @brief cacheKey - builds the result cache key of a search
+     * @param start - id of the starting city
+     * @param end - id of the ending city
+     * @param objective - criterion minimised
+     * @return key of the search
+     */
+    PlanCache::Key cacheKey(const int start, const int end, const FlightSearch::Objective objective) const;
+
+    /**
+     * @brief planBytes - estimates the memory held by a vector of plans
+     * @param plans - plans to measure
+     * @return size in bytes
+     */
+    size_t planBytes(const DSVector<Plan>& plans) const;
 
     /**
-     * @brief cheapestFlightPaths - returns the cheapest 3 flight paths between the given cities
-     * @param start - starting city
-     * @param end - ending city
-     * @return a vector containing the cheapest 3 paths
+     * @brief getPenalties - returns the connection penalties used by the searches
+     * @return penalties between connecting flights
      */
-    DSVector<Plan> cheapestFlightPaths(const DSString start, const DSString end);
+    FlightSearch::Penalties getPenalties() const;
 
     /**
-     * @brief fastestFlightPaths - returns the fastest 3 flight paths between the given cities
-     * @param start - starting city
-     * @param end - ending city
-     * @return a vector containing the fastest 3 paths
+     * @brief toPlans - converts search paths into plans
+     * @param start - id of the starting city
+     * @param paths - paths found by a search
+     * @return plans with one city per stop
      */
-    DSVector<Plan> fastestFlightPaths(const DSString start, const DSString end);
+    DSVector<Plan> toPlans(const int start, const DSVector<FlightSearch::Path>& paths) const;
 
     /**
      * @brief writeToFile - outputs the given flight paths to the given file
-     * @param paths - flight paths to output
+     * @param requests - requests the paths were planned for
+     * @param paths - flight paths to output, one vector per request
      * @param filePath - path to the output file
+     * @return false if the file could not be opened or written
      */
-    void writeToFile(const DSVector<DSVector<Plan>> paths, const DSString filePath) const;
+    bool writeToFile(const DSVector<Request>& requests, const DSVector<DSVector<Plan>>& paths, const DSString& filePath) const;
 };
 
 #endif // FLIGHTPLANNER_H
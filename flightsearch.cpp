@@ -0,0 +1,143 @@
+#include "flightsearch.h"
+
+/**
+ * @brief FlightSearch - constructor
+ * @param network - network to search, must outlive the search
+ * @param penalties - penalties added between connecting flights
+ */
+FlightSearch::FlightSearch(const FlightNetwork& network, const Penalties& penalties)
+    : network(network), penalties(penalties) {}
+
+/**
+ * @brief comesBefore - compares the objective, then the other criterion, then the number of flights,
+ * then the flight indices so that every engine breaks ties the same way
+ * @param a - first path
+ * @param b - second path
+ * @param objective - criterion compared first
+ * @return true if a ranks before b
+ */
+bool FlightSearch::comesBefore(const Path& a, const Path& b, const Objective objective)
+{
+    int aPrimary = objective == TIME ? a.totalTime : a.totalCost;
+    int bPrimary = objective == TIME ? b.totalTime : b.totalCost;
+    if(aPrimary != bPrimary){
+        return aPrimary < bPrimary;
+    }
+
+    int aSecondary = objective == TIME ? a.totalCost : a.totalTime;
+    int bSecondary = objective == TIME ? b.totalCost : b.totalTime;
+    if(aSecondary != bSecondary){
+        return aSecondary < bSecondary;
+    }
+
+    if(a.edges.getNumIndexes() != b.edges.getNumIndexes()){
+        return a.edges.getNumIndexes() < b.edges.getNumIndexes();
+    }
+
+    const int* aEdges = a.edges.getData();
+    const int* bEdges = b.edges.getData();
+    for(int i = 0; i < a.edges.getNumIndexes(); i++){
+        if(aEdges[i] != bEdges[i]){
+            return aEdges[i] < bEdges[i];
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief sameEdges - returns true if both paths take the same flights
+ * @param a - first path
+ * @param b - second path
+ * @return true if the flight lists are equal
+ */
+bool FlightSearch::sameEdges(const Path& a, const Path& b)
+{
+    return a.edges == b.edges;
+}
+
+/**
+ * @brief connectionTime - layover plus airline change time, nothing before the first flight
+ * @param prevEdge - flight taken before, -1 if next is the first flight
+ * @param nextEdge - flight taken next
+ * @return penalty time
+ */
+int FlightSearch::connectionTime(const int prevEdge, const int nextEdge) const
+{
+    if(prevEdge == -1){
+        return 0;
+    }
+
+    int time = penalties.layoverTime;
+    if(network.getEdge(prevEdge).airline != network.getEdge(nextEdge).airline){
+        time += penalties.airlineChangeTime;
+    }
+
+    return time;
+}
+
+/**
+ * @brief connectionCost - layover plus airline change cost, nothing before the first flight
+ * @param prevEdge - flight taken before, -1 if next is the first flight
+ * @param nextEdge - flight taken next
+ * @return penalty cost
+ */
+int FlightSearch::connectionCost(const int prevEdge, const int nextEdge) const
+{
+    if(prevEdge == -1){
+        return 0;
+    }
+
+    int cost = penalties.layoverCost;
+    if(network.getEdge(prevEdge).airline != network.getEdge(nextEdge).airline){
+        cost += penalties.airlineChangeCost;
+    }
+
+    return cost;
+}
+
+/**
+ * @brief addLeg - appends a flight to a path and adds its time, cost and connection penalties to the totals
+ * @param path - path to extend
+ * @param edge - flight to append
+ */
+void FlightSearch::addLeg(Path& path, const int edge) const
+{
+    int prevEdge = path.edges.getNumIndexes() == 0 ? -1 : path.edges.back();
+    const FlightNetwork::Edge& flight = network.getEdge(edge);
+
+    path.totalTime += flight.time + connectionTime(prevEdge, edge);
+    path.totalCost += flight.cost + connectionCost(prevEdge, edge);
+    path.edges.pushBack(edge);
+}
+
+/**
+ * @brief sortPaths - insertion sorts paths by comesBefore, the lists sorted here only hold a handful of paths
+ * @param paths - paths to sort
+ * @param objective - criterion compared first
+ */
+void FlightSearch::sortPaths(DSVector<Path>& paths, const Objective objective)
+{
+    Path* pathData = paths.getData();
+
+    for(int i = 1; i < paths.getNumIndexes(); i++){
+        Path current = pathData[i];
+        int j = i - 1;
+
+        while(j >= 0 && comesBefore(current, pathData[j], objective)){
+            pathData[j + 1] = pathData[j];
+            j--;
+        }
+
+        pathData[j + 1] = current;
+    }
+}
+
+/**
+ * @brief getStats - returns the counters of the last search, all zero unless built with FLIGHTPLANNER_STATS
+ * @return work done by the last search
+ */
+const SearchStats& FlightSearch::getStats() const
+{
+    return stats;
+}
@@ -0,0 +1,112 @@
+#ifndef FLIGHTSEARCH_H
+#define FLIGHTSEARCH_H
+
+#include "DataStructures/DSVector/dsvector.h"
+#include "flightnetwork.h"
+#include "searchstats.h"
+
+/**
+ * @brief The FlightSearch class - shared types and path arithmetic for the search engines over a FlightNetwork
+ *
+ * A path is the list of flight (edge) indices it takes. Every stop between two flights adds the layover penalty,
+ * and the airline change penalty is added when the two flights are on different airlines.
+ */
+class FlightSearch
+{
+public:
+    /**
+     * @brief The Objective enum - criterion a search minimises first, the other one breaks ties
+     */
+    enum Objective{
+        TIME,
+        COST
+    };
+
+    /**
+     * @brief The Penalties struct - time and cost added between two connecting flights
+     */
+    struct Penalties{
+        int layoverTime;
+        int layoverCost;
+        int airlineChangeTime;
+        int airlineChangeCost;
+    };
+
+    /**
+     * @brief The Path struct - flights taken and their totals, including penalties
+     */
+    struct Path{
+        DSVector<int> edges;
+        int totalTime = 0;
+        int totalCost = 0;
+    };
+
+    /**
+     * @brief FlightSearch - constructor
+     * @param network - network to search, must outlive the search
+     * @param penalties - penalties added between connecting flights
+     */
+    FlightSearch(const FlightNetwork& network, const Penalties& penalties);
+
+    /**
+     * @brief comesBefore - returns true if path a ranks before path b for the given objective
+     * @param a - first path
+     * @param b - second path
+     * @param objective - criterion compared first
+     * @return true if a ranks before b
+     */
+    static bool comesBefore(const Path& a, const Path& b, const Objective objective);
+
+    /**
+     * @brief sameEdges - returns true if both paths take the same flights
+     * @param a - first path
+     * @param b - second path
+     * @return true if the flight lists are equal
+     */
+    static bool sameEdges(const Path& a, const Path& b);
+
+    /**
+     * @brief getStats - returns the counters of the last search, all zero unless built with FLIGHTPLANNER_STATS
+     * @return work done by the last search
+     */
+    const SearchStats& getStats() const;
+
+protected:
+    const FlightNetwork& network;
+    Penalties penalties;
+
+    // counters of the last search, reset when a search starts
+    SearchStats stats;
+
+    /**
+     * @brief connectionTime - returns the penalty time of taking a flight after another
+     * @param prevEdge - flight taken before, -1 if next is the first flight
+     * @param nextEdge - flight taken next
+     * @return penalty time
+     */
+    int connectionTime(const int prevEdge, const int nextEdge) const;
+
+    /**
+     * @brief connectionCost - returns the penalty cost of taking a flight after another
+     * @param prevEdge - flight taken before, -1 if next is the first flight
+     * @param nextEdge - flight taken next
+     * @return penalty cost
+     */
+    int connectionCost(const int prevEdge, const int nextEdge) const;
+
+    /**
+     * @brief addLeg - appends a flight to a path and updates its totals
+     * @param path - path to extend
+     * @param edge - flight to append
+     */
+    void addLeg(Path& path, const int edge) const;
+
+    /**
+     * @brief sortPaths - sorts paths by the given objective
+     * @param paths - paths to sort
+     * @param objective - criterion compared first
+     */
+    static void sortPaths(DSVector<Path>& paths, const Objective objective);
+};
+
+#endif // FLIGHTSEARCH_H
@@ -0,0 +1,289 @@
+#include "kshortestpaths.h"
+
+/**
+ * @brief KShortestPaths - constructor
+ * @param network - network to search, must outlive the search
+ * @param penalties - penalties added between connecting flights
+ */
+KShortestPaths::KShortestPaths(const FlightNetwork& network, const Penalties& penalties)
+    : FlightSearch(network, penalties), objective(TIME) {}
+
+/**
+ * @brief find - runs Yen's algorithm: every accepted path is deviated from at each of its stops, with the stops
+ * before the deviation blocked and the flights already used by accepted paths sharing the same root banned
+ * @param start - id of the starting airport
+ * @param end - id of the destination airport
+ * @param objective - criterion to minimise
+ * @param k - maximum number of paths to return
+ * @return up to k paths, best first
+ */
+DSVector<FlightSearch::Path> KShortestPaths::find(const int start, const int end, const Objective objective, const int k)
+{
+    this->objective = objective;
+
+    stats = SearchStats();
+    SEARCH_STAT(SearchStats::Timer timer(stats.seconds));
+
+    DSVector<Path> accepted;
+    DSVector<Path> candidates;
+
+    if(k <= 0 || start == end){
+        return accepted;
+    }
+
+    Path first;
+    nextStamp();
+    if(!shortestSpur(Path(), start, end, first)){
+        return accepted;
+    }
+    accepted.pushBack(first);
+
+    while(accepted.getNumIndexes() < k){
+        const Path last = accepted.back();
+        const int* lastEdges = last.edges.getData();
+
+        Path root;
+        int spur = start;
+
+        for(int i = 0; i < last.edges.getNumIndexes(); i++){
+            nextStamp();
+
+            // block every stop of the root except the spur itself
+            if(i > 0){
+                blockedStamps.getData()[start] = stamp;
+            }
+            for(int j = 0; j < i - 1; j++){
+                blockedStamps.getData()[network.getEdge(lastEdges[j]).dest] = stamp;
+            }
+
+            // ban the next flight of every accepted path that shares this root
+            const Path* acceptedData = accepted.getData();
+            for(int j = 0; j < accepted.getNumIndexes(); j++){
+                const Path& other = acceptedData[j];
+                if(other.edges.getNumIndexes() <= i){
+                    continue;
+                }
+
+                bool sameRoot = true;
+                for(int l = 0; l < i && sameRoot; l++){
+                    sameRoot = other.edges.getData()[l] == lastEdges[l];
+                }
+
+                if(sameRoot){
+                    bannedStamps.getData()[other.edges.getData()[i]] = stamp;
+                }
+            }
+
+            Path candidate;
+            if(shortestSpur(root, spur, end, candidate)){
+                bool duplicate = false;
+
+                for(int j = 0; j < candidates.getNumIndexes() && !duplicate; j++){
+                    duplicate = sameEdges(candidates.getData()[j], candidate);
+                }
+                for(int j = 0; j < accepted.getNumIndexes() && !duplicate; j++){
+                    duplicate = sameEdges(accepted.getData()[j], candidate);
+                }
+
+                if(!duplicate){
+                    SEARCH_STAT(stats.bytes += sizeof(Path) + candidate.edges.getNumIndexes() * sizeof(int));
+                    candidates.pushBack(std::move(candidate));
+                } else {
+                    SEARCH_STAT(stats.pruned++);
+                }
+            }
+
+            addLeg(root, lastEdges[i]);
+            spur = network.getEdge(lastEdges[i]).dest;
+        }
+
+        if(candidates.getNumIndexes() == 0){
+            break;
+        }
+
+        // move the best candidate to the accepted paths
+        Path* candidateData = candidates.getData();
+        int best = 0;
+        for(int i = 1; i < candidates.getNumIndexes(); i++){
+            if(comesBefore(candidateData[i], candidateData[best], objective)){
+                best = i;
+            }
+        }
+
+        accepted.pushBack(std::move(candidateData[best]));
+        candidateData[best] = std::move(candidateData[candidates.getNumIndexes() - 1]);
+        candidates.removeLast();
+    }
+
+    return accepted;
+}
+
+/**
+ * @brief nextStamp - bumps the stamp so every scratch entry from earlier searches reads as unset
+ */
+void KShortestPaths::nextStamp()
+{
+    while(labels.getNumIndexes() < network.edgeCount()){
+        labels.pushBack(Label());
+        labelStamps.pushBack(0);
+        bannedStamps.pushBack(0);
+    }
+
+    while(blockedStamps.getNumIndexes() < network.airportCount()){
+        blockedStamps.pushBack(0);
+    }
+
+    stamp++;
+}
+
+/**
+ * @brief spurBefore - collects both parent chains back to the flight they start after, then compares them from
+ * their first flight on
+ * @param left - last flight of the first chain
+ * @param right - last flight of the second chain
+ * @param prevEdge - flight the chains start after, the root's last flight or -1
+ * @return true if the first chain comes first
+ */
+bool KShortestPaths::spurBefore(const int left, const int right, const int prevEdge)
+{
+    const Label* labelData = labels.getData();
+
+    leftTrail.clear();
+    rightTrail.clear();
+    for(int e = left; e != prevEdge; e = labelData[e].parent){
+        leftTrail.pushBack(e);
+    }
+    for(int e = right; e != prevEdge; e = labelData[e].parent){
+        rightTrail.pushBack(e);
+    }
+
+    const int* leftData = leftTrail.getData();
+    const int* rightData = rightTrail.getData();
+    for(int i = leftTrail.getNumIndexes() - 1; i >= 0; i--){
+        if(leftData[i] != rightData[i]){
+            return leftData[i] < rightData[i];
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief shortestSpur - Dijkstra over flights starting with the spur airport's flights, keyed by the objective,
+ * the other criterion and the number of flights, continuing from the root's totals and last flight. A flight
+ * reached again with the same key keeps the path with the smaller flight indices, and a tie for the end is settled
+ * the same way, so the spur found is the first one under comesBefore. A flight whose label improves while it is
+ * queued has its key lowered in place, so every flight popped is settled
+ * @param root - path up to the spur airport
+ * @param spur - id of the spur airport
+ * @param end - id of the destination airport
+ * @param result - set to root followed by the spur path if one is found
+ * @return true if a path was found
+ */
+bool KShortestPaths::shortestSpur(const Path& root, const int spur, const int end, Path& result)
+{
+    queue.clear();
+
+    Label* labelData = labels.getData();
+    int* labelStampData = labelStamps.getData();
+    int* blockedData = blockedStamps.getData();
+    const int* bannedData = bannedStamps.getData();
+
+    blockedData[spur] = stamp;
+
+    int prevEdge = root.edges.getNumIndexes() == 0 ? -1 : root.edges.back();
+    long long basePrimary = objective == TIME ? root.totalTime : root.totalCost;
+    long long baseSecondary = objective == TIME ? root.totalCost : root.totalTime;
+
+    // relaxes the flight with the key of arriving by it from parent
+    auto relax = [&](const int edge, const int parent, const long long primary, const long long secondary, const int legs){
+        const FlightNetwork::Edge& flight = network.getEdge(edge);
+        int time = flight.time + connectionTime(parent, edge);
+        int cost = flight.cost + connectionCost(parent, edge);
+
+        long long newPrimary = primary + (objective == TIME ? time : cost);
+        long long newSecondary = secondary + (objective == TIME ? cost : time);
+
+        Label& label = labelData[edge];
+        if(labelStampData[edge] == stamp){
+            QueueKey known = {label.primary, label.secondary, label.legs, edge};
+            QueueKey found = {newPrimary, newSecondary, legs + 1, edge};
+
+            if(known < found || (!(found < known) && (label.parent == parent || !spurBefore(parent, label.parent, prevEdge)))){
+                SEARCH_STAT(stats.pruned++);
+                return;
+            }
+        }
+
+        labelStampData[edge] = stamp;
+        label.primary = newPrimary;
+        label.secondary = newSecondary;
+        label.legs = legs + 1;
+        label.parent = parent;
+        queue.pushOrDecrease({newPrimary, newSecondary, legs + 1, edge}, edge);
+        SEARCH_STAT(stats.bytes += sizeof(QueueKey));
+        SEARCH_STAT(stats.frontier(queue.size()));
+    };
+
+    for(int e = network.firstEdge(spur); e < network.lastEdge(spur); e++){
+        SEARCH_STAT(stats.relaxed++);
+        if(bannedData[e] != stamp && blockedData[network.getEdge(e).dest] != stamp){
+            relax(e, prevEdge, basePrimary, baseSecondary, 0);
+        }
+    }
+
+    while(!queue.empty()){
+        QueueKey entry = queue.topKey();
+        queue.pop();
+
+        SEARCH_STAT(stats.settled++);
+        int airport = network.getEdge(entry.edge).dest;
+
+        if(airport == end){
+            // flights into the end with the same totals and number of flights are all settled, keep the first
+            int last = entry.edge;
+            while(!queue.empty() && queue.topKey().primary == entry.primary && queue.topKey().secondary == entry.secondary
+                    && queue.topKey().legs == entry.legs){
+                int tied = queue.topValue();
+                queue.pop();
+
+                if(network.getEdge(tied).dest == end && spurBefore(tied, last, prevEdge)){
+                    last = tied;
+                }
+            }
+
+            // walk the parents back to the spur, stopping at the root's last flight
+            DSVector<int> spurEdges;
+            for(int e = last; e != prevEdge; e = labelData[e].parent){
+                spurEdges.pushBack(e);
+            }
+
+            // a spur that revisits a stop is not loopless, this needs penalties that reward revisiting
+            const int* spurData = spurEdges.getData();
+            for(int i = 0; i < spurEdges.getNumIndexes(); i++){
+                for(int j = i + 1; j < spurEdges.getNumIndexes(); j++){
+                    if(network.getEdge(spurData[i]).dest == network.getEdge(spurData[j]).dest){
+                        SEARCH_STAT(stats.pruned++);
+                        return false;
+                    }
+                }
+            }
+
+            result = root;
+            for(int i = spurEdges.getNumIndexes() - 1; i >= 0; i--){
+                addLeg(result, spurData[i]);
+            }
+
+            return true;
+        }
+
+        for(int e = network.firstEdge(airport); e < network.lastEdge(airport); e++){
+            SEARCH_STAT(stats.relaxed++);
+            if(blockedData[network.getEdge(e).dest] != stamp){
+                relax(e, entry.edge, entry.primary, entry.secondary, entry.legs);
+            }
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,114 @@
+#ifndef KSHORTESTPATHS_H
+#define KSHORTESTPATHS_H
+
+#include "DataStructures/DSPriorityQueue/dspriorityqueue.h"
+#include "DataStructures/DSVector/dsvector.h"
+#include "flightsearch.h"
+
+/**
+ * @brief The KShortestPaths class - Yen's k shortest loopless paths over a FlightNetwork
+ *
+ * Connection penalties depend on the previous flight, so the shortest path searches run over flights rather than
+ * airports: a search state is the flight used to arrive at an airport. Each spur search ranks paths exactly like
+ * comesBefore, down to the flight indices, so Yen's algorithm returns the same paths as the other engines on ties.
+ */
+class KShortestPaths : public FlightSearch
+{
+public:
+    /**
+     * @brief KShortestPaths - constructor
+     * @param network - network to search, must outlive the search
+     * @param penalties - penalties added between connecting flights
+     */
+    KShortestPaths(const FlightNetwork& network, const Penalties& penalties);
+
+    /**
+     * @brief find - returns the best k loopless paths between two airports
+     * @param start - id of the starting airport
+     * @param end - id of the destination airport
+     * @param objective - criterion to minimise
+     * @param k - maximum number of paths to return
+     * @return up to k paths, best first
+     */
+    DSVector<Path> find(const int start, const int end, const Objective objective, const int k);
+
+private:
+    /**
+     * @brief The Label struct - best known key of arriving by a flight
+     */
+    struct Label{
+        long long primary;
+        long long secondary;
+        int legs;
+        int parent;
+    };
+
+    /**
+     * @brief The QueueKey struct - order flights leave the spur search queue in, by objective, then the other
+     * criterion, then number of flights, then flight index. Every flight adds a leg, so a flight's key is always
+     * after the key of the flight it extends
+     */
+    struct QueueKey{
+        long long primary;
+        long long secondary;
+        int legs;
+        int edge;
+
+        bool operator<(const QueueKey& other) const{
+            if(primary != other.primary){
+                return primary < other.primary;
+            }
+            if(secondary != other.secondary){
+                return secondary < other.secondary;
+            }
+            if(legs != other.legs){
+                return legs < other.legs;
+            }
+            return edge < other.edge;
+        }
+    };
+
+    Objective objective;
+
+    // flights waiting in the spur search, keyed by their label, kept between searches so it only allocates once
+    DSPriorityQueue<QueueKey, int> queue;
+
+    // scratch arrays sized to the network, entries are only valid when their stamp matches the current search
+    DSVector<Label> labels;
+    DSVector<int> labelStamps;
+    DSVector<int> blockedStamps;
+    DSVector<int> bannedStamps;
+    int stamp = 0;
+
+    // flights of the two spur paths being compared, last flight first
+    DSVector<int> leftTrail;
+    DSVector<int> rightTrail;
+
+    /**
+     * @brief nextStamp - starts a new spur search, resizing the scratch arrays if needed
+     */
+    void nextStamp();
+
+    /**
+     * @brief spurBefore - returns true if the spur path ending with one parent chain has smaller flight indices than
+     * the one ending with another, both chains having the same number of flights
+     * @param left - last flight of the first chain
+     * @param right - last flight of the second chain
+     * @param prevEdge - flight the chains start after, the root's last flight or -1
+     * @return true if the first chain comes first
+     */
+    bool spurBefore(const int left, const int right, const int prevEdge);
+
+    /**
+     * @brief shortestSpur - finds the best path from the spur airport to the end avoiding blocked airports and banned
+     * flights
+     * @param root - path up to the spur airport
+     * @param spur - id of the spur airport
+     * @param end - id of the destination airport
+     * @param result - set to root followed by the spur path if one is found
+     * @return true if a path was found
+     */
+    bool shortestSpur(const Path& root, const int spur, const int end, Path& result);
+};
+
+#endif // KSHORTESTPATHS_H
@@ -1,17 +1,141 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
 #include "DataStructures/DSString/dsstring.h"
 
 #include "flightplanner.h"
+#include "plannerserver.h"
 
 int main(int argc, char* argv[])
 {
-    DSString dataPath = argv[1];
-    DSString plansPath = argv[2];
-    DSString outputPath = argv[3];
-
     FlightPlanner flights = FlightPlanner();
 
-    flights.createFlightList(dataPath);
-    flights.planFlights(plansPath, outputPath);
+    bool printCacheStats = false;
+    const char* networkPath = nullptr;
+    const char* socketPath = nullptr;
+    const char* statsPath = nullptr;
+
+    // options come before the data, plans and output paths
+    int arg = 1;
+    while(arg < argc && std::strncmp(argv[arg], "--", 2) == 0){
+        if(std::strcmp(argv[arg], "--threads") == 0 && arg + 1 < argc){
+            flights.setThreadCount(std::atoi(argv[arg + 1]));
+            arg += 2;
+        } else if(std::strcmp(argv[arg], "--cache-mb") == 0 && arg + 1 < argc){
+            flights.setCacheSize(static_cast<size_t>(std::atoi(argv[arg + 1])) * 1024 * 1024);
+            arg += 2;
+        } else if(std::strcmp(argv[arg], "--cache-stats") == 0){
+            printCacheStats = true;
+            arg++;
+        } else if(std::strcmp(argv[arg], "--network") == 0 && arg + 1 < argc){
+            networkPath = argv[arg + 1];
+            arg += 2;
+        } else if(std::strcmp(argv[arg], "--socket") == 0 && arg + 1 < argc){
+            socketPath = argv[arg + 1];
+            arg += 2;
+        } else if(std::strcmp(argv[arg], "--engine") == 0 && arg + 1 < argc){
+            if(std::strcmp(argv[arg + 1], "pareto") == 0){
+                flights.setEngine(FlightPlanner::PARETO);
+            } else if(std::strcmp(argv[arg + 1], "ksp") == 0){
+                flights.setEngine(FlightPlanner::K_SHORTEST);
+            } else if(std::strcmp(argv[arg + 1], "dfs") == 0){
+                flights.setEngine(FlightPlanner::BRANCH_BOUND);
+            } else {
+                std::cerr << "Unknown engine: " << argv[arg + 1] << ", expected pareto, ksp or dfs" << std::endl;
+                return 1;
+            }
+            arg += 2;
+        } else if(std::strcmp(argv[arg], "--stats") == 0 && arg + 1 < argc){
+            statsPath = argv[arg + 1];
+            arg += 2;
+        } else {
+            std::cerr << "Unknown option: " << argv[arg] << std::endl;
+            return 1;
+        }
+    }
+
+#ifndef FLIGHTPLANNER_STATS
+    if(statsPath != nullptr){
+        std::cerr << "--stats needs a build configured with -DFLIGHTPLANNER_STATS=ON" << std::endl;
+        return 1;
+    }
+#endif
+
+    // compile mode writes the network built from a data file and exits
+    if(arg < argc && std::strcmp(argv[arg], "compile") == 0){
+        if(argc - arg < 3){
+            std::cerr << "Usage: FlightPlanner compile <flight data> <compiled network>" << std::endl;
+            return 1;
+        }
+
+        if(!flights.createFlightList(argv[arg + 1])){
+            return 1;
+        }
+
+        return flights.compileNetwork(argv[arg + 2]) ? 0 : 1;
+    }
+
+    // serve mode loads the network once and answers requests on a socket, or on stdin and stdout
+    if(arg < argc && std::strcmp(argv[arg], "serve") == 0){
+        if(networkPath == nullptr && argc - arg < 2){
+            std::cerr << "Usage: FlightPlanner [--threads N] [--cache-mb N] [--engine pareto|ksp|dfs] [--socket path] serve <flight data>\n"
+                      << "       FlightPlanner [--threads N] [--cache-mb N] [--engine pareto|ksp|dfs] [--socket path] --network <compiled network> serve" << std::endl;
+            return 1;
+        }
+
+        if(networkPath == nullptr){
+            if(!flights.createFlightList(argv[arg + 1])){
+                return 1;
+            }
+        } else if(!flights.loadNetwork(networkPath)){
+            return 1;
+        }
+
+        PlannerServer server(flights);
+        if(socketPath == nullptr){
+            server.serveStream(std::cin, std::cout);
+            return 0;
+        }
+
+        return server.serveSocket(socketPath) ? 0 : 1;
+    }
+
+    // a compiled network replaces the data file argument
+    int numPaths = networkPath == nullptr ? 3 : 2;
+    if(argc - arg < numPaths){
+        std::cerr << "Usage: FlightPlanner [--threads N] [--cache-mb N] [--cache-stats] [--engine pareto|ksp|dfs] [--stats file] <flight data> <flight plans> <output>\n"
+                  << "       FlightPlanner [--threads N] [--cache-mb N] [--cache-stats] [--engine pareto|ksp|dfs] [--stats file] --network <compiled network> <flight plans> <output>\n"
+                  << "       FlightPlanner [--socket path] serve <flight data>\n"
+                  << "       FlightPlanner compile <flight data> <compiled network>" << std::endl;
+        return 1;
+    }
+
+    if(networkPath == nullptr){
+        if(!flights.createFlightList(argv[arg])){
+            return 1;
+        }
+        arg++;
+    } else if(!flights.loadNetwork(networkPath)){
+        return 1;
+    }
+
+    DSString plansPath = argv[arg];
+    DSString outputPath = argv[arg + 1];
+
+    if(!flights.planFlights(plansPath, outputPath)){
+        return 1;
+    }
+
+    if(statsPath != nullptr && !flights.writeStats(statsPath)){
+        return 1;
+    }
+
+    if(printCacheStats){
+        FlightPlanner::PlanCache::Stats stats = flights.getCacheStats();
+        std::cerr << "cache hits: " << stats.hits << " misses: " << stats.misses << " evictions: " << stats.evictions
+                  << " entries: " << stats.entries << " bytes: " << stats.bytes << "/" << stats.maxBytes << std::endl;
+    }
 
     return 0;
 }
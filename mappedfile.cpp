@@ -0,0 +1,118 @@
+#include "mappedfile.h"
+
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief MappedFile - default constructor, no file is open
+ */
+MappedFile::MappedFile() {}
+
+/**
+ * @brief open - maps the file privately and read only, hinting sequential access, and falls back to reading it
+ * into a buffer when it cannot be mapped
+ * @param filePath - path to the file
+ * @return true if the file could be opened
+ */
+bool MappedFile::open(const DSString& filePath)
+{
+    close();
+
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if(fd == -1){
+        return false;
+    }
+
+    struct stat info;
+    if(fstat(fd, &info) == 0 && S_ISREG(info.st_mode)){
+        length = static_cast<size_t>(info.st_size);
+
+        if(length == 0){
+            ::close(fd);
+            return true;
+        }
+
+        void* region = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(region != MAP_FAILED){
+            madvise(region, length, MADV_SEQUENTIAL);
+            ::close(fd);
+
+            bytes = static_cast<char*>(region);
+            mapped = true;
+            return true;
+        }
+    }
+
+    // not a regular file or not mappable, read it whole
+    size_t capacity = 1 << 16;
+    bytes = new char[capacity];
+    length = 0;
+
+    ssize_t numRead;
+    while((numRead = read(fd, bytes + length, capacity - length)) > 0){
+        length += static_cast<size_t>(numRead);
+
+        if(length == capacity){
+            char* grown = new char[capacity * 2];
+            std::memcpy(grown, bytes, length);
+            delete[] bytes;
+            bytes = grown;
+            capacity *= 2;
+        }
+    }
+
+    ::close(fd);
+
+    if(numRead < 0){
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief close - unmaps the file or frees the buffer it was read into
+ */
+void MappedFile::close()
+{
+    if(mapped){
+        munmap(bytes, length);
+    } else {
+        delete[] bytes;
+    }
+
+    bytes = nullptr;
+    length = 0;
+    mapped = false;
+}
+
+/**
+ * @brief data - returns the first byte of the file
+ * @return pointer to the bytes, nullptr for an empty or closed file
+ */
+const char* MappedFile::data() const
+{
+    return length == 0 ? nullptr : bytes;
+}
+
+/**
+ * @brief size - returns the number of bytes in the file
+ * @return size of the file
+ */
+size_t MappedFile::size() const
+{
+    return length;
+}
+
+/**
+ * @brief ~MappedFile - destructor, unmaps the file
+ */
+MappedFile::~MappedFile()
+{
+    close();
+}
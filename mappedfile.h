@@ -0,0 +1,62 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+
+#include "DataStructures/DSString/dsstring.h"
+
+/**
+ * @brief The MappedFile class - read only view of a whole file, mapped into memory so it can be parsed in place
+ *
+ * Files that cannot be mapped, such as pipes, are read into a buffer instead, so callers only ever see one
+ * contiguous range of bytes.
+ */
+class MappedFile
+{
+public:
+    /**
+     * @brief MappedFile - default constructor, no file is open
+     */
+    MappedFile();
+
+    /**
+     * @brief open - maps the given file, closing any file already open
+     * @param filePath - path to the file
+     * @return true if the file could be opened
+     */
+    bool open(const DSString& filePath);
+
+    /**
+     * @brief close - unmaps the file
+     */
+    void close();
+
+    /**
+     * @brief data - returns the first byte of the file
+     * @return pointer to the bytes, nullptr for an empty or closed file
+     */
+    const char* data() const;
+
+    /**
+     * @brief size - returns the number of bytes in the file
+     * @return size of the file
+     */
+    size_t size() const;
+
+    /**
+     * @brief ~MappedFile - destructor, unmaps the file
+     */
+    ~MappedFile();
+
+private:
+    char* bytes = nullptr;
+    size_t length = 0;
+
+    // true when bytes is a mapping rather than a heap buffer
+    bool mapped = false;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+};
+
+#endif // MAPPEDFILE_H
@@ -0,0 +1,88 @@
+#include "nametable.h"
+
+/**
+ * @brief NameTable - default constructor, creates an empty table
+ */
+NameTable::NameTable() {}
+
+/**
+ * @brief NameTable - copy constructor
+ * @param other - table to copy
+ */
+NameTable::NameTable(const NameTable& other)
+{
+    *this = other;
+}
+
+/**
+ * @brief intern - hashes and compares the name in place, a string is only built for a new name
+ * @param name - name to intern
+ * @return id of the name
+ */
+int NameTable::intern(const DSStringView& name)
+{
+    return ids.insert(name, ids.size());
+}
+
+/**
+ * @brief find - looks the name up without adding it
+ * @param name - name to look up
+ * @return id of the name, -1 if it has not been interned
+ */
+int NameTable::find(const DSStringView& name) const
+{
+    return ids.indexOf(name);
+}
+
+/**
+ * @brief getName - returns the name with the given id
+ * @param id - id of the name
+ * @return reference to the name
+ */
+const DSString& NameTable::getName(const int id) const
+{
+    return ids.entryAt(id).key;
+}
+
+/**
+ * @brief size - returns the number of interned names
+ * @return number of names
+ */
+int NameTable::size() const
+{
+    return ids.size();
+}
+
+/**
+ * @brief reserve - makes room in the map for the given number of names
+ * @param numNames - number of names expected
+ */
+void NameTable::reserve(const int numNames)
+{
+    ids.reserve(numNames);
+}
+
+/**
+ * @brief clear - removes every name, the map keeps its storage
+ */
+void NameTable::clear()
+{
+    ids.clear();
+}
+
+/**
+ * @brief operator = : copies the names of the given table
+ * @param other - table to copy
+ * @return reference to this table
+ */
+NameTable& NameTable::operator=(const NameTable& other)
+{
+    ids = other.ids;
+
+    return *this;
+}
+
+/**
+ * @brief ~NameTable - destructor
+ */
+NameTable::~NameTable() {}
@@ -0,0 +1,81 @@
+#ifndef NAMETABLE_H
+#define NAMETABLE_H
+
+#include "DataStructures/DSString/dsstring.h"
+#include "DataStructures/DSStringView/dsstringview.h"
+#include "DataStructures/DSHashMap/dshashmap.h"
+
+/**
+ * @brief The NameTable class - interns names into dense integer ids starting at 0
+ *
+ * Names are never removed, so the id of a name is the index of its entry in the map.
+ */
+class NameTable
+{
+public:
+    /**
+     * @brief NameTable - default constructor, creates an empty table
+     */
+    NameTable();
+
+    /**
+     * @brief NameTable - copy constructor
+     * @param other - table to copy
+     */
+    NameTable(const NameTable& other);
+
+    /**
+     * @brief intern - returns the id of a name, assigning the next id and copying the name only if it is new
+     * @param name - name to intern
+     * @return id of the name
+     */
+    int intern(const DSStringView& name);
+
+    /**
+     * @brief find - returns the id of a name without adding it
+     * @param name - name to look up
+     * @return id of the name, -1 if it has not been interned
+     */
+    int find(const DSStringView& name) const;
+
+    /**
+     * @brief getName - returns the name with the given id
+     * @param id - id of the name
+     * @return reference to the name
+     */
+    const DSString& getName(const int id) const;
+
+    /**
+     * @brief size - returns the number of interned names
+     * @return number of names
+     */
+    int size() const;
+
+    /**
+     * @brief reserve - makes room for the given number of names without regrowing
+     * @param numNames - number of names expected
+     */
+    void reserve(const int numNames);
+
+    /**
+     * @brief clear - removes every name
+     */
+    void clear();
+
+    /**
+     * @brief operator = : sets this table equal to the given table
+     * @param other - table to copy
+     * @return reference to this table
+     */
+    NameTable& operator=(const NameTable& other);
+
+    /**
+     * @brief ~NameTable - destructor
+     */
+    ~NameTable();
+
+private:
+    DSHashMap<DSString, int> ids;
+};
+
+#endif // NAMETABLE_H
@@ -0,0 +1,291 @@
+#include "networkfile.h"
+
+#include <cstring>
+#include <fstream>
+
+static const char MAGIC[8] = {'F', 'P', 'N', 'E', 'T', 'W', 'K', '\0'};
+
+/**
+ * @brief NetworkFile - default constructor, no file is open
+ */
+NetworkFile::NetworkFile() {}
+
+/**
+ * @brief write - lays every section out in one zeroed buffer, checksums it and writes it after the header
+ * @param filePath - path of the file to write
+ * @param network - network to store
+ * @param airports - names of the network's airports, ids past the network's airports are not stored
+ * @param airlines - names of the airlines
+ * @return true if the file was written
+ */
+bool NetworkFile::write(const DSString& filePath, const FlightNetwork& network, const NameTable& airports, const NameTable& airlines)
+{
+    int numAirports = network.airportCount();
+    int numEdges = network.edgeCount();
+    int numAirlines = airlines.size();
+
+    Header header;
+    std::memset(&header, 0, sizeof(Header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.edgeSize = sizeof(FlightNetwork::Edge);
+    header.byteOrder = ORDER_MARK;
+    header.numAirports = numAirports;
+    header.numEdges = numEdges;
+    header.numAirlines = numAirlines;
+
+    for(int i = 0; i < numAirports; i++){
+        header.airportNameBytes += airports.getName(i).size() + 1;
+    }
+    for(int i = 0; i < numAirlines; i++){
+        header.airlineNameBytes += airlines.getName(i).size() + 1;
+    }
+
+    uint64_t offsetBytes = padded((numAirports + 1) * sizeof(int));
+    uint64_t edgeBytes = padded(numEdges * sizeof(FlightNetwork::Edge));
+    uint64_t airportOffsetBytes = offsetBytes;
+    uint64_t airportNameBytes = padded(header.airportNameBytes);
+    uint64_t airlineOffsetBytes = padded((numAirlines + 1) * sizeof(int));
+
+    header.payloadBytes = offsetBytes + edgeBytes + airportOffsetBytes + airportNameBytes + airlineOffsetBytes
+                          + padded(header.airlineNameBytes);
+
+    char* payload = new char[header.payloadBytes]();
+    char* pos = payload;
+
+    std::memcpy(pos, network.getOffsets(), (numAirports + 1) * sizeof(int));
+    pos += offsetBytes;
+
+    if(numEdges > 0){
+        std::memcpy(pos, network.getEdges(), numEdges * sizeof(FlightNetwork::Edge));
+    }
+    pos += edgeBytes;
+
+    // each name table is its offsets followed by the names they point into
+    const NameTable* tables[2] = {&airports, &airlines};
+    int counts[2] = {numAirports, numAirlines};
+    uint64_t offsetSizes[2] = {airportOffsetBytes, airlineOffsetBytes};
+    uint64_t nameSizes[2] = {airportNameBytes, padded(header.airlineNameBytes)};
+
+    for(int t = 0; t < 2; t++){
+        int* nameOffsets = reinterpret_cast<int*>(pos);
+        char* names = pos + offsetSizes[t];
+
+        int offset = 0;
+        for(int i = 0; i < counts[t]; i++){
+            const DSString& name = tables[t]->getName(i);
+            nameOffsets[i] = offset;
+            std::memcpy(names + offset, name.c_str(), name.size() + 1);
+            offset += name.size() + 1;
+        }
+        nameOffsets[counts[t]] = offset;
+
+        pos = names + nameSizes[t];
+    }
+
+    header.checksum = checksum(payload, header.payloadBytes);
+
+    std::ofstream file(filePath.c_str(), std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    file.write(payload, header.payloadBytes);
+    file.close();
+
+    delete[] payload;
+
+    return !file.fail();
+}
+
+/**
+ * @brief open - maps the file, then checks the header against this build, the checksum of the payload and that
+ * every offset, edge and name stays within its section, so a bad file cannot send a search out of bounds
+ * @param filePath - path to the file
+ * @return true if the file is a valid network of this version
+ */
+bool NetworkFile::open(const DSString& filePath)
+{
+    close();
+
+    if(!file.open(filePath) || file.size() < sizeof(Header)){
+        close();
+        return false;
+    }
+
+    const Header* candidate = reinterpret_cast<const Header*>(file.data());
+    if(std::memcmp(candidate->magic, MAGIC, sizeof(MAGIC)) != 0 || candidate->version != VERSION
+            || candidate->edgeSize != sizeof(FlightNetwork::Edge) || candidate->byteOrder != ORDER_MARK
+            || candidate->numAirports < 0 || candidate->numEdges < 0 || candidate->numAirlines < 0){
+        close();
+        return false;
+    }
+
+    // the counts are non-negative 32 bit values, so in 64 bits every section size below stays under 2^40, and name
+    // sizes past the file are rejected before padding them could wrap, which keeps the sum exact
+    if(candidate->airportNameBytes > file.size() || candidate->airlineNameBytes > file.size()){
+        close();
+        return false;
+    }
+
+    uint64_t offsetBytes = padded((static_cast<uint64_t>(candidate->numAirports) + 1) * sizeof(int));
+    uint64_t edgeBytes = padded(static_cast<uint64_t>(candidate->numEdges) * sizeof(FlightNetwork::Edge));
+    uint64_t airportNameBytes = padded(candidate->airportNameBytes);
+    uint64_t airlineOffsetBytes = padded((static_cast<uint64_t>(candidate->numAirlines) + 1) * sizeof(int));
+    uint64_t airlineNameBytes = padded(candidate->airlineNameBytes);
+
+    uint64_t payloadBytes = offsetBytes * 2 + edgeBytes + airportNameBytes + airlineOffsetBytes + airlineNameBytes;
+    if(candidate->payloadBytes != payloadBytes || file.size() != sizeof(Header) + payloadBytes){
+        close();
+        return false;
+    }
+
+    const char* payload = file.data() + sizeof(Header);
+    if(checksum(payload, payloadBytes) != candidate->checksum){
+        close();
+        return false;
+    }
+
+    const char* pos = payload;
+    offsets = reinterpret_cast<const int*>(pos);
+    pos += offsetBytes;
+    edges = reinterpret_cast<const FlightNetwork::Edge*>(pos);
+    pos += edgeBytes;
+    airportNameOffsets = reinterpret_cast<const int*>(pos);
+    pos += offsetBytes;
+    airportNames = pos;
+    pos += airportNameBytes;
+    airlineNameOffsets = reinterpret_cast<const int*>(pos);
+    pos += airlineOffsetBytes;
+    airlineNames = pos;
+
+    bool valid = offsets[0] == 0 && offsets[candidate->numAirports] == candidate->numEdges;
+    for(int i = 0; valid && i < candidate->numAirports; i++){
+        valid = offsets[i] <= offsets[i + 1];
+    }
+    for(int i = 0; valid && i < candidate->numEdges; i++){
+        valid = edges[i].dest >= 0 && edges[i].dest < candidate->numAirports
+                && edges[i].airline >= 0 && edges[i].airline < candidate->numAirlines;
+    }
+
+    valid = valid && validNames(airportNameOffsets, airportNames, candidate->numAirports, candidate->airportNameBytes)
+                  && validNames(airlineNameOffsets, airlineNames, candidate->numAirlines, candidate->airlineNameBytes);
+
+    if(!valid){
+        close();
+        return false;
+    }
+
+    header = candidate;
+    return true;
+}
+
+/**
+ * @brief close - unmaps the file and forgets its sections
+ */
+void NetworkFile::close()
+{
+    file.close();
+    header = nullptr;
+    offsets = nullptr;
+    edges = nullptr;
+    airportNameOffsets = nullptr;
+    airportNames = nullptr;
+    airlineNameOffsets = nullptr;
+    airlineNames = nullptr;
+}
+
+/**
+ * @brief attachTo - points a network at the mapped offsets and edges, and rebuilds the name tables from the mapped
+ * names, which costs one string per name rather than anything per flight
+ * @param network - network to attach
+ * @param airports - set to the airport names
+ * @param airlines - set to the airline names
+ * @return false if the file repeats a name
+ */
+bool NetworkFile::attachTo(FlightNetwork& network, NameTable& airports, NameTable& airlines) const
+{
+    airports.clear();
+    airlines.clear();
+
+    if(!internNames(airportNameOffsets, airportNames, header->numAirports, airports)
+            || !internNames(airlineNameOffsets, airlineNames, header->numAirlines, airlines)){
+        airports.clear();
+        airlines.clear();
+        return false;
+    }
+
+    network.attach(header->numAirports, header->numEdges, offsets, edges);
+    return true;
+}
+
+/**
+ * @brief padded - rounds a section size up to the next 8 byte boundary
+ * @param bytes - size of the section
+ * @return size including padding
+ */
+uint64_t NetworkFile::padded(const uint64_t bytes)
+{
+    return (bytes + 7) & ~static_cast<uint64_t>(7);
+}
+
+/**
+ * @brief checksum - FNV style hash over 64 bit words, each word is mixed down so every byte reaches the result
+ * @param data - buffer to hash, 8 byte aligned
+ * @param bytes - size of the buffer, a multiple of 8
+ * @return hash of the buffer
+ */
+uint64_t NetworkFile::checksum(const char* data, const uint64_t bytes)
+{
+    const uint64_t* words = reinterpret_cast<const uint64_t*>(data);
+    uint64_t hash = 14695981039346656037ull;
+
+    for(uint64_t i = 0; i < bytes / 8; i++){
+        hash ^= words[i];
+        hash *= 1099511628211ull;
+        hash ^= hash >> 29;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief validNames - checks that the offsets rise within the section and every name ends in a null
+ * @param nameOffsets - count + 1 offsets into names
+ * @param names - characters of the names
+ * @param count - number of names
+ * @param nameBytes - size of the characters
+ * @return true if every name is in bounds and null terminated
+ */
+bool NetworkFile::validNames(const int* nameOffsets, const char* names, const int count, const uint64_t nameBytes)
+{
+    if(nameOffsets[0] != 0 || static_cast<uint64_t>(nameOffsets[count]) != nameBytes){
+        return false;
+    }
+
+    for(int i = 0; i < count; i++){
+        if(nameOffsets[i] >= nameOffsets[i + 1] || names[nameOffsets[i + 1] - 1] != '\0'){
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief internNames - interns the names of a section in id order
+ * @param nameOffsets - count + 1 offsets into names
+ * @param names - characters of the names
+ * @param count - number of names
+ * @param table - table to fill
+ * @return false if a name repeats, which would shift the ids
+ */
+bool NetworkFile::internNames(const int* nameOffsets, const char* names, const int count, NameTable& table)
+{
+    table.reserve(count);
+
+    for(int i = 0; i < count; i++){
+        if(table.intern(DSStringView(names + nameOffsets[i], nameOffsets[i + 1] - nameOffsets[i] - 1)) != i){
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,128 @@
+#ifndef NETWORKFILE_H
+#define NETWORKFILE_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "DataStructures/DSString/dsstring.h"
+#include "flightnetwork.h"
+#include "nametable.h"
+#include "mappedfile.h"
+
+/**
+ * @brief The NetworkFile class - compiled flight network, mapped and used in place
+ *
+ * A header is followed by the CSR offsets, the edges, then the offsets and null terminated characters of the
+ * airport and airline names. Every section starts on an 8 byte boundary, and the checksum covers every byte after
+ * the header. Values are stored in the byte order of the machine that compiled the file.
+ */
+class NetworkFile
+{
+public:
+    static const uint32_t VERSION = 1;
+
+    /**
+     * @brief NetworkFile - default constructor, no file is open
+     */
+    NetworkFile();
+
+    /**
+     * @brief write - compiles a network and its names into a file
+     * @param filePath - path of the file to write
+     * @param network - network to store
+     * @param airports - names of the network's airports, ids past the network's airports are not stored
+     * @param airlines - names of the airlines
+     * @return true if the file was written
+     */
+    static bool write(const DSString& filePath, const FlightNetwork& network, const NameTable& airports, const NameTable& airlines);
+
+    /**
+     * @brief open - maps a compiled network and checks its header and checksum
+     * @param filePath - path to the file
+     * @return true if the file is a valid network of this version
+     */
+    bool open(const DSString& filePath);
+
+    /**
+     * @brief close - unmaps the file
+     */
+    void close();
+
+    /**
+     * @brief attachTo - points a network at the mapped arrays and interns the mapped names, the file must stay open
+     * while the network is used
+     * @param network - network to attach
+     * @param airports - set to the airport names
+     * @param airlines - set to the airline names
+     * @return false if the file repeats a name
+     */
+    bool attachTo(FlightNetwork& network, NameTable& airports, NameTable& airlines) const;
+
+private:
+    /**
+     * @brief The Header struct - layout of the start of the file
+     */
+    struct Header{
+        char magic[8];
+        uint32_t version;
+        // guards against files written by a build with a different Edge layout or byte order
+        uint32_t edgeSize;
+        uint32_t byteOrder;
+        int32_t numAirports;
+        int32_t numEdges;
+        int32_t numAirlines;
+        uint64_t airportNameBytes;
+        uint64_t airlineNameBytes;
+        uint64_t payloadBytes;
+        uint64_t checksum;
+    };
+
+    static const uint32_t ORDER_MARK = 0x01020304;
+
+    MappedFile file;
+    const Header* header = nullptr;
+
+    const int* offsets = nullptr;
+    const FlightNetwork::Edge* edges = nullptr;
+    const int* airportNameOffsets = nullptr;
+    const char* airportNames = nullptr;
+    const int* airlineNameOffsets = nullptr;
+    const char* airlineNames = nullptr;
+
+    /**
+     * @brief padded - rounds a section size up to the next 8 byte boundary
+     * @param bytes - size of the section
+     * @return size including padding
+     */
+    static uint64_t padded(const uint64_t bytes);
+
+    /**
+     * @brief checksum - hashes a buffer one 64 bit word at a time
+     * @param data - buffer to hash, 8 byte aligned
+     * @param bytes - size of the buffer, a multiple of 8
+     * @return hash of the buffer
+     */
+    static uint64_t checksum(const char* data, const uint64_t bytes);
+
+    /**
+     * @brief validNames - checks that a name section is terminated where its offsets say
+     * @param nameOffsets - count + 1 offsets into names
+     * @param names - characters of the names
+     * @param count - number of names
+     * @param nameBytes - size of the characters
+     * @return true if every name is in bounds and null terminated
+     */
+    static bool validNames(const int* nameOffsets, const char* names, const int count, const uint64_t nameBytes);
+
+    /**
+     * @brief internNames - interns the names of a section in id order
+     * @param nameOffsets - count + 1 offsets into names
+     * @param names - characters of the names
+     * @param count - number of names
+     * @param table - table to fill
+     * @return false if a name repeats, which would shift the ids
+     */
+    static bool internNames(const int* nameOffsets, const char* names, const int count, NameTable& table);
+};
+
+#endif // NETWORKFILE_H
@@ -0,0 +1,437 @@
+#include "paretosearch.h"
+
+#include <climits>
+#include <functional>
+#include <queue>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief The QueueEntry struct - label waiting to be expanded, ordered by time then cost
+ */
+struct QueueEntry{
+    int time;
+    int cost;
+    int label;
+
+    bool operator>(const QueueEntry& other) const{
+        if(time != other.time){
+            return time > other.time;
+        }
+        if(cost != other.cost){
+            return cost > other.cost;
+        }
+        return label > other.label;
+    }
+};
+
+}
+
+/**
+ * @brief ParetoSearch - constructor
+ * @param network - network to search, must outlive the search
+ * @param penalties - penalties added between connecting flights
+ * @param k - number of paths needed per objective
+ */
+ParetoSearch::ParetoSearch(const FlightNetwork& network, const Penalties& penalties, const int k)
+    : FlightSearch(network, penalties), k(k) {}
+
+/**
+ * @brief search - searches for a single destination
+ * @param start - id of the starting airport
+ * @param end - id of the destination airport
+ */
+void ParetoSearch::search(const int start, const int end)
+{
+    DSVector<int> ends;
+    ends.pushBack(end);
+
+    search(start, ends);
+}
+
+/**
+ * @brief search - expands labels in time order, skipping labels that are dominated at their airport or that
+ * cannot beat the labels already at any destination, with a single destination its labels are never expanded
+ * @param start - id of the starting airport
+ * @param ends - ids of the destination airports, every airport is searched if empty
+ */
+void ParetoSearch::search(const int start, const DSVector<int>& ends)
+{
+    this->start = start;
+
+    stats = SearchStats();
+    SEARCH_STAT(SearchStats::Timer timer(stats.seconds));
+
+    labels.clear();
+    while(bags.getNumIndexes() < network.airportCount()){
+        bags.pushBack(DSVector<int>());
+        markStamps.pushBack(0);
+        targetSlots.pushBack(-1);
+    }
+    DSVector<int>* bagData = bags.getData();
+    for(int i = 0; i < bags.getNumIndexes(); i++){
+        if(bagData[i].getNumIndexes() > 0){
+            bagData[i].clear();
+        }
+    }
+
+    int* slotData = targetSlots.getData();
+    for(int i = 0; i < targets.getNumIndexes(); i++){
+        slotData[targets.getData()[i]] = -1;
+    }
+    targets.clear();
+    targetTimes.clear();
+    targetCosts.clear();
+
+    for(int i = 0; i < ends.getNumIndexes(); i++){
+        int end = ends.getData()[i];
+        if(slotData[end] == -1){
+            slotData[end] = targets.getNumIndexes();
+            targets.pushBack(end);
+            targetTimes.pushBack(DSVector<int>());
+            targetCosts.pushBack(DSVector<int>());
+        }
+    }
+
+    // no destination has k labels yet
+    boundTime = INT_MAX;
+    boundCost = INT_MAX;
+
+    int singleTarget = targets.getNumIndexes() == 1 ? targets.getData()[0] : -1;
+
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+
+    // stores a label that survived pruning and queues it for expansion
+    auto addLabel = [&](const int time, const int cost, const int edge, const int airport, const int parent){
+        Label label;
+        label.time = time;
+        label.cost = cost;
+        label.edge = edge;
+        label.airport = airport;
+        label.parent = parent;
+        label.dead = false;
+
+        int index = labels.getNumIndexes();
+        labels.pushBack(label);
+        bagData[airport].pushBack(index);
+        queue.push({time, cost, index});
+        SEARCH_STAT(stats.bytes += sizeof(Label) + sizeof(int) + sizeof(QueueEntry));
+        SEARCH_STAT(stats.frontier(queue.size()));
+
+        if(slotData[airport] != -1){
+            addTargetLabel(slotData[airport], time, cost);
+        }
+    };
+
+    for(int e = network.firstEdge(start); e < network.lastEdge(start); e++){
+        const FlightNetwork::Edge& flight = network.getEdge(e);
+
+        SEARCH_STAT(stats.relaxed++);
+
+        if(flight.dest != start && !isDominated(flight.time, flight.cost, e, flight.dest, -1, -1)){
+            addLabel(flight.time, flight.cost, e, flight.dest, -1);
+        } else {
+            SEARCH_STAT(stats.pruned++);
+        }
+    }
+
+    while(!queue.empty()){
+        int index = queue.top().label;
+        queue.pop();
+
+        // labels added since this one was queued may dominate it now
+        const Label& queued = labels.getData()[index];
+        if(isDominated(queued.time, queued.cost, queued.edge, queued.airport, queued.parent, index)){
+            labels.getData()[index].dead = true;
+            SEARCH_STAT(stats.pruned++);
+            continue;
+        }
+
+        Label& label = labels.getData()[index];
+
+        if(label.airport == singleTarget){
+            continue;
+        }
+
+        if(isTargetBounded(label.time, label.cost)){
+            label.dead = true;
+            SEARCH_STAT(stats.pruned++);
+            continue;
+        }
+
+        SEARCH_STAT(stats.settled++);
+
+        int time = label.time;
+        int cost = label.cost;
+        int edge = label.edge;
+        int airport = label.airport;
+
+        for(int e = network.firstEdge(airport); e < network.lastEdge(airport); e++){
+            const FlightNetwork::Edge& flight = network.getEdge(e);
+            SEARCH_STAT(stats.relaxed++);
+
+            if(visits(index, flight.dest)){
+                SEARCH_STAT(stats.pruned++);
+                continue;
+            }
+
+            int newTime = time + flight.time + connectionTime(edge, e);
+            int newCost = cost + flight.cost + connectionCost(edge, e);
+
+            if(isTargetBounded(newTime, newCost)){
+                SEARCH_STAT(stats.pruned++);
+                continue;
+            }
+            if(isDominated(newTime, newCost, e, flight.dest, index, -1)){
+                SEARCH_STAT(stats.pruned++);
+                continue;
+            }
+
+            addLabel(newTime, newCost, e, flight.dest, index);
+        }
+    }
+}
+
+/**
+ * @brief bestPaths - rebuilds the live labels at the destination into paths, sorts them and keeps the first k
+ * @param end - id of the destination airport
+ * @param objective - criterion to rank the paths by
+ * @return up to k paths, best first
+ */
+DSVector<FlightSearch::Path> ParetoSearch::bestPaths(const int end, const Objective objective) const
+{
+    DSVector<Path> paths;
+
+    if(end < 0 || end >= bags.getNumIndexes()){
+        return paths;
+    }
+
+    const Label* labelData = labels.getData();
+    const DSVector<int>& bag = bags.getData()[end];
+
+    for(int i = 0; i < bag.getNumIndexes(); i++){
+        const Label& label = labelData[bag.getData()[i]];
+        if(label.dead){
+            continue;
+        }
+
+        DSVector<int> reversed(8);
+        for(int l = bag.getData()[i]; l != -1; l = labelData[l].parent){
+            reversed.pushBack(labelData[l].edge);
+        }
+
+        Path path;
+        path.totalTime = label.time;
+        path.totalCost = label.cost;
+        path.edges.reserve(reversed.getNumIndexes());
+        for(int j = reversed.getNumIndexes() - 1; j >= 0; j--){
+            path.edges.pushBack(reversed.getData()[j]);
+        }
+
+        paths.pushBack(std::move(path));
+    }
+
+    sortPaths(paths, objective);
+
+    while(paths.getNumIndexes() > k){
+        paths.removeLast();
+    }
+
+    return paths;
+}
+
+/**
+ * @brief isDominated - counts the live labels at the airport that are at least as good as the given label for
+ * every extension: a label on another airline must also make up for a possible airline change, and a label may
+ * only stop where the given label stops so that every loopless extension of one is loopless for the other. A label
+ * that is not strictly better in either criterion can tie every extension, so it must also rank first by its flights
+ * @param time - time of the label
+ * @param cost - cost of the label
+ * @param edge - flight the label arrives by
+ * @param airport - airport the label ends at
+ * @param parent - label the label extends, -1 if it starts at the starting airport
+ * @param self - index of the label itself, -1 if it has not been stored
+ * @return true if the label can be pruned
+ */
+bool ParetoSearch::isDominated(const int time, const int cost, const int edge, const int airport, const int parent, const int self)
+{
+    const Label* labelData = labels.getData();
+    const DSVector<int>& bag = bags.getData()[airport];
+    int airline = network.getEdge(edge).airline;
+    int dominators = 0;
+
+    if(bag.getNumIndexes() < k){
+        return false;
+    }
+
+    markStamp++;
+    int* markData = markStamps.getData();
+    for(int l = parent; l != -1; l = labelData[l].parent){
+        markData[labelData[l].airport] = markStamp;
+    }
+
+    for(int i = 0; i < bag.getNumIndexes(); i++){
+        int index = bag.getData()[i];
+        const Label& other = labelData[index];
+
+        if(index == self || other.dead){
+            continue;
+        }
+
+        int slackTime = 0;
+        int slackCost = 0;
+        if(network.getEdge(other.edge).airline != airline){
+            slackTime = penalties.airlineChangeTime;
+            slackCost = penalties.airlineChangeCost;
+        }
+
+        if(other.time + slackTime > time || other.cost + slackCost > cost){
+            continue;
+        }
+        if(other.time + slackTime == time && other.cost + slackCost == cost && !ranksBefore(index, edge, parent)){
+            continue;
+        }
+
+        bool subset = true;
+        for(int l = other.parent; l != -1 && subset; l = labelData[l].parent){
+            subset = markData[labelData[l].airport] == markStamp;
+        }
+
+        if(subset){
+            dominators++;
+            if(dominators >= k){
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief ranksBefore - collects both paths' flights, then compares their counts and their indices from the first
+ * flight on
+ * @param label - index of the stored label
+ * @param edge - last flight of the other path
+ * @param parent - label the other path extends, -1 if it starts at the starting airport
+ * @return true if the label comes first
+ */
+bool ParetoSearch::ranksBefore(const int label, const int edge, const int parent)
+{
+    const Label* labelData = labels.getData();
+
+    leftTrail.clear();
+    rightTrail.clear();
+    for(int l = label; l != -1; l = labelData[l].parent){
+        leftTrail.pushBack(labelData[l].edge);
+    }
+    rightTrail.pushBack(edge);
+    for(int l = parent; l != -1; l = labelData[l].parent){
+        rightTrail.pushBack(labelData[l].edge);
+    }
+
+    if(leftTrail.getNumIndexes() != rightTrail.getNumIndexes()){
+        return leftTrail.getNumIndexes() < rightTrail.getNumIndexes();
+    }
+
+    const int* leftData = leftTrail.getData();
+    const int* rightData = rightTrail.getData();
+    for(int i = leftTrail.getNumIndexes() - 1; i >= 0; i--){
+        if(leftData[i] != rightData[i]){
+            return leftData[i] < rightData[i];
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief addTargetLabel - inserts the totals into the destination's k smallest times and costs, then recomputes the
+ * bound as the largest k-th smallest value over the destinations
+ * @param slot - index of the destination in targets
+ * @param time - time of the label
+ * @param cost - cost of the label
+ */
+void ParetoSearch::addTargetLabel(const int slot, const int time, const int cost)
+{
+    // keeps the k smallest values of a sorted vector
+    auto insertSmallest = [&](DSVector<int>& values, const int value){
+        if(values.getNumIndexes() == k && values.back() <= value){
+            return;
+        }
+        if(values.getNumIndexes() < k){
+            values.pushBack(value);
+        }
+
+        int* valueData = values.getData();
+        int i = values.getNumIndexes() - 1;
+        while(i > 0 && valueData[i - 1] > value){
+            valueData[i] = valueData[i - 1];
+            i--;
+        }
+        valueData[i] = value;
+    };
+
+    insertSmallest(targetTimes.getData()[slot], time);
+    insertSmallest(targetCosts.getData()[slot], cost);
+
+    int newBoundTime = 0;
+    int newBoundCost = 0;
+    for(int i = 0; i < targets.getNumIndexes(); i++){
+        const DSVector<int>& times = targetTimes.getData()[i];
+        const DSVector<int>& costs = targetCosts.getData()[i];
+
+        if(times.getNumIndexes() < k){
+            return;
+        }
+
+        if(times.back() > newBoundTime){
+            newBoundTime = times.back();
+        }
+        if(costs.back() > newBoundCost){
+            newBoundCost = costs.back();
+        }
+    }
+
+    boundTime = newBoundTime;
+    boundCost = newBoundCost;
+}
+
+/**
+ * @brief isTargetBounded - flights and penalties never lower the totals, so a label that is slower than the k-th
+ * fastest and costlier than the k-th cheapest label at every destination cannot produce a path in any top k
+ * @param time - time of the label
+ * @param cost - cost of the label
+ * @return true if no extension of the label can reach any top k
+ */
+bool ParetoSearch::isTargetBounded(const int time, const int cost) const
+{
+    if(targets.getNumIndexes() == 0){
+        return false;
+    }
+
+    return time > boundTime && cost > boundCost;
+}
+
+/**
+ * @brief visits - walks the label's parents looking for the airport
+ * @param label - index of the label
+ * @param airport - id of the airport
+ * @return true if the path starts at or stops at airport
+ */
+bool ParetoSearch::visits(int label, const int airport) const
+{
+    if(airport == start){
+        return true;
+    }
+
+    const Label* labelData = labels.getData();
+    for(; label != -1; label = labelData[label].parent){
+        if(labelData[label].airport == airport){
+            return true;
+        }
+    }
+
+    return false;
+}
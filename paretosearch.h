@@ -0,0 +1,134 @@
+#ifndef PARETOSEARCH_H
+#define PARETOSEARCH_H
+
+#include "DataStructures/DSVector/dsvector.h"
+#include "flightsearch.h"
+
+/**
+ * @brief The ParetoSearch class - bi-criteria label setting search over (time, cost)
+ *
+ * Every label is a loopless path ending at an airport. A label is pruned once k other labels at the same airport
+ * dominate it in both time and cost while only stopping at airports it also stops at, so the labels left at the
+ * destination hold the best k paths by time and the best k paths by cost, and one search answers both objectives.
+ * A label that could tie with the one it is checked against only dominates it if comesBefore ranks it first, so
+ * ties keep the path with the fewest flights and then the smallest flight indices, like the other engines.
+ */
+class ParetoSearch : public FlightSearch
+{
+public:
+    /**
+     * @brief ParetoSearch - constructor
+     * @param network - network to search, must outlive the search
+     * @param penalties - penalties added between connecting flights
+     * @param k - number of paths needed per objective
+     */
+    ParetoSearch(const FlightNetwork& network, const Penalties& penalties, const int k);
+
+    /**
+     * @brief search - finds the labels between two airports
+     * @param start - id of the starting airport
+     * @param end - id of the destination airport
+     */
+    void search(const int start, const int end);
+
+    /**
+     * @brief search - finds the labels from one airport to many destinations at once
+     * @param start - id of the starting airport
+     * @param ends - ids of the destination airports, every airport is searched if empty
+     */
+    void search(const int start, const DSVector<int>& ends);
+
+    /**
+     * @brief bestPaths - returns the best k paths found to the destination for an objective
+     * @param end - id of the destination airport
+     * @param objective - criterion to rank the paths by
+     * @return up to k paths, best first
+     */
+    DSVector<Path> bestPaths(const int end, const Objective objective) const;
+
+private:
+    /**
+     * @brief The Label struct - a path ending at airport, arriving by edge after the parent label
+     */
+    struct Label{
+        int time;
+        int cost;
+        int edge;
+        int airport;
+        int parent;
+        bool dead;
+    };
+
+    int k;
+    int start = -1;
+
+    DSVector<Label> labels;
+    // label indices at each airport
+    DSVector<DSVector<int>> bags;
+
+    // airports on the path of the label being checked are marked with the current stamp
+    DSVector<int> markStamps;
+    int markStamp = 0;
+
+    // flights of the two paths being ranked by ranksBefore, last flight first
+    DSVector<int> leftTrail;
+    DSVector<int> rightTrail;
+
+    // index of each airport in targets, -1 for airports that are not destinations
+    DSVector<int> targetSlots;
+    DSVector<int> targets;
+    // k smallest times and costs of the labels at each destination, ascending
+    DSVector<DSVector<int>> targetTimes;
+    DSVector<DSVector<int>> targetCosts;
+    // largest k-th smallest time and cost over all destinations
+    int boundTime = 0;
+    int boundCost = 0;
+
+    /**
+     * @brief isDominated - returns true if k live labels at the label's airport dominate it
+     * @param time - time of the label
+     * @param cost - cost of the label
+     * @param edge - flight the label arrives by
+     * @param airport - airport the label ends at
+     * @param parent - label the label extends, -1 if it starts at the starting airport
+     * @param self - index of the label itself, -1 if it has not been stored
+     * @return true if the label can be pruned
+     */
+    bool isDominated(const int time, const int cost, const int edge, const int airport, const int parent, const int self);
+
+    /**
+     * @brief ranksBefore - returns true if a stored label's flights come before another path's under comesBefore,
+     * which only compares flight counts and indices once both totals are equal
+     * @param label - index of the stored label
+     * @param edge - last flight of the other path
+     * @param parent - label the other path extends, -1 if it starts at the starting airport
+     * @return true if the label comes first
+     */
+    bool ranksBefore(const int label, const int edge, const int parent);
+
+    /**
+     * @brief addTargetLabel - records the totals of a label that reached a destination
+     * @param slot - index of the destination in targets
+     * @param time - time of the label
+     * @param cost - cost of the label
+     */
+    void addTargetLabel(const int slot, const int time, const int cost);
+
+    /**
+     * @brief isTargetBounded - returns true if every destination already holds k labels faster and k labels cheaper
+     * @param time - time of the label
+     * @param cost - cost of the label
+     * @return true if no extension of the label can reach any top k
+     */
+    bool isTargetBounded(const int time, const int cost) const;
+
+    /**
+     * @brief visits - returns true if the label's path passes through the given airport
+     * @param label - index of the label
+     * @param airport - id of the airport
+     * @return true if the path starts at or stops at airport
+     */
+    bool visits(int label, const int airport) const;
+};
+
+#endif // PARETOSEARCH_H
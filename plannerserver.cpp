@@ -0,0 +1,232 @@
+#include "plannerserver.h"
+
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/**
+ * @brief PlannerServer - constructor
+ * @param planner - loaded planner to answer from, must outlive the server
+ */
+PlannerServer::PlannerServer(FlightPlanner& planner) : planner(planner) {}
+
+/**
+ * @brief serveStream - reads request lines and flushes each answer before reading the next line, a line longer than
+ * MAX_LINE_LENGTH is answered with ERROR and skipped without being stored
+ * @param in - stream of requests
+ * @param out - stream of answers
+ */
+void PlannerServer::serveStream(std::istream& in, std::ostream& out)
+{
+    FlightPlanner::RouteSearch search = planner.createSearch();
+    int number = 0;
+
+    char line[MAX_LINE_LENGTH + 1];
+    while(in.getline(line, sizeof(line)) || in.gcount() > 0){
+        // getline fails without reaching a newline or the end of the input only when the buffer is full
+        if(in.fail() && !in.eof()){
+            in.clear();
+            in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            out << "ERROR request line too long\n\n";
+            out.flush();
+            continue;
+        }
+
+        int length = int(in.gcount()) - (in.eof() ? 0 : 1);
+        bool open = handleLine(DSStringView(line, length), number, search, out);
+        out.flush();
+
+        if(!open){
+            return;
+        }
+    }
+}
+
+/**
+ * @brief serveSocket - binds the socket, then accepts clients forever, each on a detached thread
+ * @param socketPath - path of the socket, replaced if it exists
+ * @return false if the socket could not be created
+ */
+bool PlannerServer::serveSocket(const DSString& socketPath)
+{
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+
+    if(socketPath.size() >= static_cast<int>(sizeof(address.sun_path))){
+        std::cerr << "Socket path too long: " << socketPath << std::endl;
+        return false;
+    }
+    std::strcpy(address.sun_path, socketPath.c_str());
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(listener == -1){
+        std::cerr << "Could not create socket: " << socketPath << std::endl;
+        return false;
+    }
+
+    unlink(socketPath.c_str());
+    if(bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == -1 || listen(listener, 64) == -1){
+        std::cerr << "Could not listen on socket: " << socketPath << std::endl;
+        close(listener);
+        return false;
+    }
+
+    while(true){
+        int client = accept(listener, nullptr, nullptr);
+        if(client == -1){
+            continue;
+        }
+
+        std::thread(&PlannerServer::serveClient, this, client).detach();
+    }
+}
+
+/**
+ * @brief handleLine - splits the line into fields and runs the request under the network lock it needs
+ * @param line - request line
+ * @param number - number of plan requests answered so far on this connection, incremented by a plan request
+ * @param search - searches reused by this connection's plan requests
+ * @param out - stream to write the answer to
+ * @return false if the client asked to close the connection
+ */
+bool PlannerServer::handleLine(const DSStringView& line, int& number, FlightPlanner::RouteSearch& search, std::ostream& out)
+{
+    // one field more than any request takes, so longer lines are rejected
+    DSStringView fieldData[7];
+    int numFields = line.split(fieldData, 7);
+
+    if(numFields == 0){
+        return true;
+    }
+
+    const DSStringView& command = fieldData[0];
+
+    if(command == "QUIT"){
+        return false;
+    }
+
+    if((command == "ADD" || command == "REPRICE") && numFields == 6){
+        // a bad time or cost is rejected before the network is locked, so nothing changes
+        int time;
+        int cost;
+        if(!fieldData[3].parseInt(time) || !fieldData[4].parseInt(cost) || time < 0 || cost < 0){
+            out << "ERROR time and cost must be integers from 0 to " << INT_MAX << "\n\n";
+            return true;
+        }
+
+        std::unique_lock<std::shared_mutex> lock(networkMutex);
+        if(command == "ADD"){
+            planner.addFlight(fieldData[1], fieldData[2], time, cost, fieldData[5]);
+            out << "OK 2\n\n";
+        } else {
+            out << "OK " << planner.repriceFlight(fieldData[1], fieldData[2], time, cost, fieldData[5]) << "\n\n";
+        }
+    } else if(command == "CANCEL" && numFields == 4){
+        std::unique_lock<std::shared_mutex> lock(networkMutex);
+        out << "OK " << planner.cancelFlight(fieldData[1], fieldData[2], fieldData[3]) << "\n\n";
+    } else if(numFields == 3){
+        if(fieldData[2] != "T" && fieldData[2] != "C"){
+            out << "ERROR mode must be T or C\n\n";
+            return true;
+        }
+        char mode = fieldData[2][0];
+
+        std::shared_lock<std::shared_mutex> lock(networkMutex);
+        DSVector<FlightPlanner::Plan> plans = planner.planRoute(fieldData[0], fieldData[1], mode, search);
+        planner.writePlans(out, ++number, fieldData[0], fieldData[1], mode, plans);
+        out << "\n";
+    } else {
+        out << "ERROR malformed request\n\n";
+    }
+
+    return true;
+}
+
+/**
+ * @brief serveClient - buffers the bytes read from the connection, answers every complete line and sends each
+ * answer whole, a line longer than MAX_LINE_LENGTH is answered with ERROR and its bytes are dropped as they arrive
+ * @param client - file descriptor of the connection, closed on return
+ */
+void PlannerServer::serveClient(const int client)
+{
+    FlightPlanner::RouteSearch search = planner.createSearch();
+    int number = 0;
+
+    std::string pending;
+    char buffer[4096];
+    bool open = true;
+    // set once an unfinished line is too long, its bytes are dropped until its newline arrives
+    bool skipping = false;
+
+    while(open){
+        ssize_t numRead = recv(client, buffer, sizeof(buffer), 0);
+        if(numRead <= 0){
+            break;
+        }
+
+        ssize_t kept = 0;
+        if(skipping){
+            const char* newline = static_cast<const char*>(std::memchr(buffer, '\n', numRead));
+            if(newline == nullptr){
+                continue;
+            }
+            skipping = false;
+            kept = newline + 1 - buffer;
+        }
+        pending.append(buffer + kept, numRead - kept);
+
+        size_t lineStart = 0;
+        size_t lineEnd;
+        while(open && (lineEnd = pending.find('\n', lineStart)) != std::string::npos){
+            std::ostringstream answer;
+            if(lineEnd - lineStart > MAX_LINE_LENGTH){
+                answer << "ERROR request line too long\n\n";
+            } else {
+                open = handleLine(DSStringView(pending.data() + lineStart, lineEnd - lineStart), number, search, answer);
+            }
+            lineStart = lineEnd + 1;
+
+            open = sendAll(client, answer.str()) && open;
+        }
+        pending.erase(0, lineStart);
+
+        // the rest of the line is not waited for, so a client that never sends a newline cannot grow pending
+        if(open && pending.size() > MAX_LINE_LENGTH){
+            pending.clear();
+            skipping = true;
+            open = sendAll(client, "ERROR request line too long\n\n");
+        }
+    }
+
+    close(client);
+}
+
+/**
+ * @brief sendAll - sends every byte of an answer, however many calls to send it takes
+ * @param client - file descriptor of the connection
+ * @param bytes - answer to send
+ * @return false if the connection failed
+ */
+bool PlannerServer::sendAll(const int client, const std::string& bytes)
+{
+    for(size_t sent = 0; sent < bytes.size();){
+        ssize_t numSent = send(client, bytes.data() + sent, bytes.size() - sent, MSG_NOSIGNAL);
+        if(numSent <= 0){
+            return false;
+        }
+        sent += numSent;
+    }
+
+    return true;
+}
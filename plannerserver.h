@@ -0,0 +1,85 @@
+#ifndef PLANNERSERVER_H
+#define PLANNERSERVER_H
+
+#include <istream>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+
+#include "DataStructures/DSString/dsstring.h"
+#include "DataStructures/DSStringView/dsstringview.h"
+#include "flightplanner.h"
+
+/**
+ * @brief The PlannerServer class - answers plan requests against a planner that stays loaded between requests
+ *
+ * Every request is one line and every answer ends with an empty line:
+ *   <start> <end> <T|C>                           the plans for the route, as they appear in the output file
+ *   ADD <origin> <dest> <time> <cost> <airline>   adds a route, answers OK and the number of flights added
+ *   CANCEL <origin> <dest> <airline>              cancels a route, answers OK and the number of flights removed
+ *   REPRICE <origin> <dest> <time> <cost> <airline> reprices a route, answers OK and the number of flights changed
+ *   QUIT                                          closes the connection
+ * Malformed lines, modes other than T or C and times or costs that are negative or do not fit in an int are
+ * answered with ERROR and leave the network as it was. A line longer than MAX_LINE_LENGTH is answered with ERROR
+ * and skipped without being kept in memory. Plan requests from different clients run in parallel and updates wait
+ * for them to finish.
+ */
+class PlannerServer
+{
+public:
+    /**
+     * @brief PlannerServer - constructor
+     * @param planner - loaded planner to answer from, must outlive the server
+     */
+    PlannerServer(FlightPlanner& planner);
+
+    /**
+     * @brief serveStream - answers the requests of one client on a pair of streams until the input ends
+     * @param in - stream of requests
+     * @param out - stream of answers
+     */
+    void serveStream(std::istream& in, std::ostream& out);
+
+    /**
+     * @brief serveSocket - listens on a unix domain socket and serves every client on its own thread, never returns
+     * unless the socket cannot be created
+     * @param socketPath - path of the socket, replaced if it exists
+     * @return false if the socket could not be created
+     */
+    bool serveSocket(const DSString& socketPath);
+
+    // longest request line read, in bytes without the newline
+    static const int MAX_LINE_LENGTH = 4096;
+
+private:
+    FlightPlanner& planner;
+
+    // plan requests share the network, updates need it alone
+    std::shared_mutex networkMutex;
+
+    /**
+     * @brief handleLine - answers one request line
+     * @param line - request line
+     * @param number - number of plan requests answered so far on this connection, incremented by a plan request
+     * @param search - searches reused by this connection's plan requests
+     * @param out - stream to write the answer to
+     * @return false if the client asked to close the connection
+     */
+    bool handleLine(const DSStringView& line, int& number, FlightPlanner::RouteSearch& search, std::ostream& out);
+
+    /**
+     * @brief serveClient - answers the requests sent on a connected socket until the client disconnects
+     * @param client - file descriptor of the connection, closed on return
+     */
+    void serveClient(const int client);
+
+    /**
+     * @brief sendAll - sends a whole answer on a connected socket
+     * @param client - file descriptor of the connection
+     * @param bytes - answer to send
+     * @return false if the connection failed
+     */
+    bool sendAll(const int client, const std::string& bytes);
+};
+
+#endif // PLANNERSERVER_H
@@ -0,0 +1,354 @@
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+#include <cstddef>
+#include <mutex>
+
+#include "DataStructures/DSHashMap/dshashmap.h"
+#include "DataStructures/DSVector/dsvector.h"
+
+/**
+ * @brief The ResultCache class - thread safe least recently used cache of search results, capped by memory
+ *
+ * Entries live in a flat array linked into a recency list by index, and a hash map from each key to its entry finds
+ * them. The caller reports the size of every value it stores.
+ */
+template <class V>
+class ResultCache
+{
+public:
+    /**
+     * @brief The Key struct - a search: airports, objective and number of paths
+     */
+    struct Key{
+        int start;
+        int end;
+        int objective;
+        int k;
+
+        bool operator==(const Key& other) const{
+            return start == other.start && end == other.end && objective == other.objective && k == other.k;
+        }
+    };
+
+    /**
+     * @brief The KeyHash struct - mixes the fields of a key with a multiplicative hash
+     */
+    struct KeyHash{
+        size_t operator()(const Key& key) const{
+            unsigned long long hash = static_cast<unsigned int>(key.start);
+            hash = hash * 0x9E3779B97F4A7C15ull + static_cast<unsigned int>(key.end);
+            hash = hash * 0x9E3779B97F4A7C15ull + static_cast<unsigned int>(key.objective);
+            hash = hash * 0x9E3779B97F4A7C15ull + static_cast<unsigned int>(key.k);
+
+            return hash ^ (hash >> 32);
+        }
+    };
+
+    /**
+     * @brief The Stats struct - counters for sizing the cache
+     */
+    struct Stats{
+        long long hits = 0;
+        long long misses = 0;
+        long long evictions = 0;
+        int entries = 0;
+        size_t bytes = 0;
+        size_t maxBytes = 0;
+    };
+
+    /**
+     * @brief ResultCache - constructor
+     * @param maxBytes - memory the cached values may use, 0 disables the cache
+     */
+    ResultCache(const size_t maxBytes = 64 * 1024 * 1024);
+
+    /**
+     * @brief get - copies the value stored for a key and marks it most recently used
+     * @param key - key to look up
+     * @param value - set to the stored value on a hit
+     * @return true on a hit
+     */
+    bool get(const Key& key, V& value);
+
+    /**
+     * @brief put - stores a value, evicting the least recently used entries until it fits
+     * @param key - key of the value
+     * @param value - value to store
+     * @param bytes - memory used by the value
+     */
+    void put(const Key& key, const V& value, const size_t bytes);
+
+    /**
+     * @brief clear - removes every entry, the counters are kept
+     */
+    void clear();
+
+    /**
+     * @brief setMaxBytes - sets the memory cap, evicting entries that no longer fit
+     * @param maxBytes - memory the cached values may use, 0 disables the cache
+     */
+    void setMaxBytes(const size_t maxBytes);
+
+    /**
+     * @brief getStats - returns the hit, miss and eviction counters and the current size
+     * @return cache counters
+     */
+    Stats getStats() const;
+
+    /**
+     * @brief ~ResultCache - destructor
+     */
+    ~ResultCache();
+
+private:
+    /**
+     * @brief The Entry struct - a stored value and its place in the recency list
+     */
+    struct Entry{
+        Key key;
+        V value;
+        size_t bytes = 0;
+        int prev = -1;
+        int next = -1;
+    };
+
+    DSVector<Entry> entries;
+    DSVector<int> freeEntries;
+
+    // most and least recently used entries
+    int head = -1;
+    int tail = -1;
+
+    // entry of every stored key
+    DSHashMap<Key, int, KeyHash> index;
+
+    Stats stats;
+    mutable std::mutex mutex;
+
+    /**
+     * @brief unlink - removes an entry from the recency list
+     * @param entry - index of the entry
+     */
+    void unlink(const int entry);
+
+    /**
+     * @brief pushFront - makes an entry the most recently used
+     * @param entry - index of the entry
+     */
+    void pushFront(const int entry);
+
+    /**
+     * @brief evict - removes the least recently used entry
+     */
+    void evict();
+};
+
+/**
+ * @brief ResultCache - constructor
+ * @param maxBytes - memory the cached values may use, 0 disables the cache
+ */
+template <class V>
+ResultCache<V>::ResultCache(const size_t maxBytes){
+    stats.maxBytes = maxBytes;
+}
+
+/**
+ * @brief get - looks the key up and moves its entry to the front of the recency list
+ * @param key - key to look up
+ * @param value - set to the stored value on a hit
+ * @return true on a hit
+ */
+template <class V>
+bool ResultCache<V>::get(const Key& key, V& value){
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const int* found = index.find(key);
+    if(found == nullptr){
+        stats.misses++;
+        return false;
+    }
+
+    int entry = *found;
+    unlink(entry);
+    pushFront(entry);
+
+    value = entries.getData()[entry].value;
+    stats.hits++;
+
+    return true;
+}
+
+/**
+ * @brief put - replaces any value stored for the key, then evicts from the back of the recency list until the
+ * new value fits, values larger than the whole cache are not stored
+ * @param key - key of the value
+ * @param value - value to store
+ * @param bytes - memory used by the value
+ */
+template <class V>
+void ResultCache<V>::put(const Key& key, const V& value, const size_t bytes){
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if(bytes > stats.maxBytes){
+        return;
+    }
+
+    const int* found = index.find(key);
+    if(found != nullptr){
+        int entry = *found;
+        Entry& existing = entries.getData()[entry];
+
+        stats.bytes -= existing.bytes;
+        existing.value = value;
+        existing.bytes = bytes;
+        stats.bytes += bytes;
+
+        unlink(entry);
+        pushFront(entry);
+    } else {
+        int entry;
+        if(freeEntries.getNumIndexes() > 0){
+            entry = freeEntries.back();
+            freeEntries.removeLast();
+        } else {
+            entry = entries.getNumIndexes();
+            entries.emplaceBack();
+        }
+
+        Entry& created = entries.getData()[entry];
+        created.key = key;
+        created.value = value;
+        created.bytes = bytes;
+
+        stats.bytes += bytes;
+        stats.entries++;
+
+        pushFront(entry);
+        index.insert(key, entry);
+    }
+
+    while(stats.bytes > stats.maxBytes){
+        evict();
+    }
+}
+
+/**
+ * @brief clear - drops every entry and empties the index, the counters are kept
+ */
+template <class V>
+void ResultCache<V>::clear(){
+    std::lock_guard<std::mutex> lock(mutex);
+
+    entries.clear();
+    freeEntries.clear();
+    head = -1;
+    tail = -1;
+
+    index.clear();
+
+    stats.entries = 0;
+    stats.bytes = 0;
+}
+
+/**
+ * @brief setMaxBytes - sets the memory cap, evicting entries that no longer fit
+ * @param maxBytes - memory the cached values may use, 0 disables the cache
+ */
+template <class V>
+void ResultCache<V>::setMaxBytes(const size_t maxBytes){
+    std::lock_guard<std::mutex> lock(mutex);
+
+    stats.maxBytes = maxBytes;
+    while(stats.bytes > stats.maxBytes){
+        evict();
+    }
+}
+
+/**
+ * @brief getStats - returns the hit, miss and eviction counters and the current size
+ * @return cache counters
+ */
+template <class V>
+typename ResultCache<V>::Stats ResultCache<V>::getStats() const{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return stats;
+}
+
+/**
+ * @brief ~ResultCache - destructor
+ */
+template <class V>
+ResultCache<V>::~ResultCache(){}
+
+/**
+ * @brief unlink - removes an entry from the recency list
+ * @param entry - index of the entry
+ */
+template <class V>
+void ResultCache<V>::unlink(const int entry){
+    Entry* entryData = entries.getData();
+    Entry& current = entryData[entry];
+
+    if(current.prev != -1){
+        entryData[current.prev].next = current.next;
+    } else {
+        head = current.next;
+    }
+
+    if(current.next != -1){
+        entryData[current.next].prev = current.prev;
+    } else {
+        tail = current.prev;
+    }
+
+    current.prev = -1;
+    current.next = -1;
+}
+
+/**
+ * @brief pushFront - makes an entry the most recently used
+ * @param entry - index of the entry
+ */
+template <class V>
+void ResultCache<V>::pushFront(const int entry){
+    Entry* entryData = entries.getData();
+
+    entryData[entry].prev = -1;
+    entryData[entry].next = head;
+
+    if(head != -1){
+        entryData[head].prev = entry;
+    }
+    head = entry;
+
+    if(tail == -1){
+        tail = entry;
+    }
+}
+
+/**
+ * @brief evict - unlinks the tail entry, removes its key from the index and frees its value
+ */
+template <class V>
+void ResultCache<V>::evict(){
+    int entry = tail;
+    if(entry == -1){
+        return;
+    }
+
+    Entry& victim = entries.getData()[entry];
+    index.erase(victim.key);
+
+    unlink(entry);
+    stats.bytes -= victim.bytes;
+    stats.entries--;
+    stats.evictions++;
+
+    victim.value = V();
+    victim.bytes = 0;
+    freeEntries.pushBack(entry);
+}
+
+#endif // RESULTCACHE_H
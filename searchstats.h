@@ -0,0 +1,71 @@
+#ifndef SEARCHSTATS_H
+#define SEARCHSTATS_H
+
+#include <chrono>
+
+/**
+ * @brief The SearchStats struct - work done by one search
+ *
+ * The engines only update the counters through SEARCH_STAT, which expands to nothing unless the build defines
+ * FLIGHTPLANNER_STATS, so a build without statistics runs the exact same search loops as before.
+ */
+struct SearchStats{
+    // labels taken off the queue and expanded
+    long long settled = 0;
+    // flights looked at while expanding labels
+    long long relaxed = 0;
+    // labels and paths thrown away as dominated, bounded, looping or duplicated
+    long long pruned = 0;
+    // largest number of entries waiting in the queue
+    long long peakFrontier = 0;
+    // memory of the labels, queue entries and paths the search created
+    long long bytes = 0;
+    double seconds = 0;
+
+    /**
+     * @brief frontier - records the current queue size
+     * @param size - number of entries waiting in the queue
+     */
+    void frontier(const long long size){
+        if(size > peakFrontier){
+            peakFrontier = size;
+        }
+    }
+
+    /**
+     * @brief add - adds the counters of another search, keeping the larger peak frontier
+     * @param other - counters to add
+     */
+    void add(const SearchStats& other){
+        settled += other.settled;
+        relaxed += other.relaxed;
+        pruned += other.pruned;
+        frontier(other.peakFrontier);
+        bytes += other.bytes;
+        seconds += other.seconds;
+    }
+
+    /**
+     * @brief The Timer class - adds the time between its construction and destruction to a counter
+     */
+    class Timer{
+    public:
+        Timer(double& seconds) : seconds(seconds), start(std::chrono::steady_clock::now()) {}
+
+        ~Timer(){
+            seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+
+    private:
+        double& seconds;
+        std::chrono::steady_clock::time_point start;
+    };
+};
+
+#ifdef FLIGHTPLANNER_STATS
+#define SEARCH_STAT(statement) statement
+#else
+#define SEARCH_STAT(statement)
+#endif
+
+#endif // SEARCHSTATS_H
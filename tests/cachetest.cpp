@@ -0,0 +1,83 @@
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "flightplanner.h"
+
+namespace {
+
+int failures = 0;
+
+/**
+ * @brief check - reports a failed expectation and counts it
+ * @param passed - result of the expectation
+ * @param what - description printed when it fails
+ */
+void check(const bool passed, const char* what)
+{
+    if(!passed){
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+/**
+ * @brief readFile - returns the contents of a file, empty if it cannot be read
+ * @param path - file to read
+ * @return contents of the file
+ */
+std::string readFile(const char* path)
+{
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+
+    return contents.str();
+}
+
+}
+
+int main()
+{
+    const char* dataFile = FLIGHTPLANNER_DATA_DIR "/sample01-flight-data.txt";
+    const char* plansFile = FLIGHTPLANNER_DATA_DIR "/sample01-req-flights.txt";
+
+    // every request of a batch looks the cache up once
+    FlightPlanner planner;
+    planner.createFlightList(dataFile);
+    planner.planFlights(plansFile, "cachetest-first.txt");
+
+    FlightPlanner::PlanCache::Stats stats = planner.getCacheStats();
+    check(stats.misses == 2 && stats.hits == 0, "two new requests are two misses");
+
+    planner.planFlights(plansFile, "cachetest-second.txt");
+    stats = planner.getCacheStats();
+    check(stats.misses == 2 && stats.hits == 2, "planning the same requests again is two hits");
+    check(readFile("cachetest-first.txt") == readFile("cachetest-second.txt"), "cached plans match searched plans");
+
+    // a request repeated in one batch is searched once and counted as a hit
+    {
+        std::ofstream repeated("cachetest-repeated-plans.txt");
+        repeated << "3\nDallas Houston T\nChicago Dallas C\nDallas Houston T\n";
+    }
+
+    FlightPlanner cached;
+    cached.createFlightList(dataFile);
+    cached.planFlights("cachetest-repeated-plans.txt", "cachetest-repeated.txt");
+
+    stats = cached.getCacheStats();
+    check(stats.misses == 2 && stats.hits == 1, "a repeat within a batch is one hit");
+    check(stats.entries == 2, "a repeat within a batch is stored once");
+
+    // without a cache the repeat still gets the plans of its first occurrence
+    FlightPlanner uncached;
+    uncached.setCacheSize(0);
+    uncached.createFlightList(dataFile);
+    uncached.planFlights("cachetest-repeated-plans.txt", "cachetest-uncached.txt");
+
+    stats = uncached.getCacheStats();
+    check(stats.misses == 3 && stats.hits == 0, "every lookup misses without a cache");
+    check(readFile("cachetest-repeated.txt") == readFile("cachetest-uncached.txt"), "a repeat gets its plans without a cache");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "flightplanner.h"
+
+namespace {
+
+int failures = 0;
+
+/**
+ * @brief check - reports a failed expectation and counts it
+ * @param passed - result of the expectation
+ * @param what - description printed when it fails
+ */
+void check(const bool passed, const char* what)
+{
+    if(!passed){
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+/**
+ * @brief readFile - returns the contents of a file, empty if it cannot be read
+ * @param path - file to read
+ * @return contents of the file
+ */
+std::string readFile(const char* path)
+{
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+
+    return contents.str();
+}
+
+/**
+ * @brief planWith - plans the requests with one engine and returns the output
+ * @param engine - search to answer the requests with
+ * @param dataFile - flight data
+ * @param plansFile - requests to plan
+ * @param outputFile - file the plans are written to
+ * @return contents of the output file
+ */
+std::string planWith(const FlightPlanner::Engine engine, const char* dataFile, const char* plansFile, const char* outputFile)
+{
+    FlightPlanner planner;
+    planner.setEngine(engine);
+    planner.createFlightList(dataFile);
+    planner.planFlights(plansFile, outputFile);
+
+    return readFile(outputFile);
+}
+
+/**
+ * @brief checkEngines - checks that every engine writes the same plans as the pareto engine
+ * @param dataFile - flight data
+ * @param plansFile - requests to plan
+ */
+void checkEngines(const char* dataFile, const char* plansFile)
+{
+    std::string pareto = planWith(FlightPlanner::PARETO, dataFile, plansFile, "enginetest-pareto.txt");
+    check(!pareto.empty(), "the pareto engine writes plans");
+    check(planWith(FlightPlanner::K_SHORTEST, dataFile, plansFile, "enginetest-ksp.txt") == pareto,
+          "k shortest paths matches pareto");
+    check(planWith(FlightPlanner::BRANCH_BOUND, dataFile, plansFile, "enginetest-dfs.txt") == pareto,
+          "branch and bound matches pareto");
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    // a fixture is a flight data file and a plans file, otherwise the generated network below is checked
+    if(argc == 3){
+        checkEngines(argv[1], argv[2]);
+        return failures == 0 ? 0 : 1;
+    }
+
+    // every pair of a 12 city cluster is connected, so there are millions of loopless paths out of Hub, but Leaf
+    // and Spur only connect to Hub and to each other, which leaves 2 paths between any two of the three
+    const int CLUSTER = 12;
+    {
+        std::ostringstream flights;
+        int count = 0;
+        for(int i = 0; i < CLUSTER; i++){
+            for(int j = i + 1; j < CLUSTER; j++){
+                flights << "C" << i << " C" << j << " " << 20 + (i * 7 + j * 3) % 40 << " " << 30 + (i * 5 + j * 11) % 50
+                        << " Air" << (i + j) % 3 << "\n";
+                count++;
+            }
+            flights << "Hub C" << i << " " << 25 + i << " " << 90 - i * 2 << " Air" << i % 3 << "\n";
+            count++;
+        }
+        flights << "Hub Leaf 50 100 Air0\n";
+        flights << "Hub Spur 30 40 Air1\n";
+        flights << "Spur Leaf 35 45 Air2\n";
+        count += 3;
+
+        std::ofstream data("enginetest-flight-data.txt");
+        data << count << "\n" << flights.str();
+
+        std::ofstream plans("enginetest-plans.txt");
+        plans << "5\nHub Leaf T\nLeaf Hub C\nC3 Leaf T\nSpur Leaf C\nC0 C7 T\n";
+    }
+
+    // branch and bound used to widen its threshold over the cluster forever, as no path through it can reach Leaf
+    checkEngines("enginetest-flight-data.txt", "enginetest-plans.txt");
+
+    FlightPlanner planner;
+    planner.setEngine(FlightPlanner::BRANCH_BOUND);
+    planner.createFlightList("enginetest-flight-data.txt");
+    FlightPlanner::RouteSearch search = planner.createSearch();
+    check(planner.planRoute("Hub", "Leaf", 'T', search).getNumIndexes() == 2, "two paths from Hub to Leaf");
+    check(planner.planRoute("C3", "Leaf", 'C', search).getNumIndexes() == 3, "three paths from the cluster to Leaf");
+
+    // the search is kept across requests, so it has to notice that the network changed under it
+    planner.setCacheSize(0);
+    planner.cancelFlight("Hub", "Leaf", "Air0");
+    DSVector<FlightPlanner::Plan> plans = planner.planRoute("Hub", "Leaf", 'T', search);
+    check(plans.getNumIndexes() == 1 && plans.getData()[0].totalTime == 130, "a cancelled flight is not planned");
+
+    planner.addFlight("C3", "Leaf", 1, 1, "Air0");
+    plans = planner.planRoute("Hub", "Leaf", 'T', search);
+    check(plans.getNumIndexes() == 3 && plans.getData()[0].path.getNumIndexes() == 3, "an added flight is planned");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,84 @@
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "plannerserver.h"
+
+namespace {
+
+int failures = 0;
+
+/**
+ * @brief check - reports a failed expectation and counts it
+ * @param passed - result of the expectation
+ * @param what - description printed when it fails
+ */
+void check(const bool passed, const char* what)
+{
+    if(!passed){
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+/**
+ * @brief serve - answers the request lines on a fresh connection
+ * @param server - server to ask
+ * @param requests - request lines, each ending in a newline
+ * @return the answers
+ */
+std::string serve(PlannerServer& server, const std::string& requests)
+{
+    std::istringstream in(requests);
+    std::ostringstream out;
+    server.serveStream(in, out);
+
+    return out.str();
+}
+
+}
+
+int main()
+{
+    {
+        std::ofstream data("servertest-flight-data.txt");
+        data << "2\nA B 10 20 Air0\nB C 5 5 Air1\n";
+    }
+
+    FlightPlanner planner;
+    planner.createFlightList("servertest-flight-data.txt");
+    PlannerServer server(planner);
+
+    const std::string plan = serve(server, "A C T\n");
+    check(plan.find("Time: 80 Cost: 44") != std::string::npos, "the route is planned");
+
+    // every bad request is answered with ERROR and the route is planned the same way afterwards
+    const char* badRequests[] = {
+        "A C X\n",
+        "A C TT\n",
+        "ADD A C x y Air2\n",
+        "ADD A C 5 1x Air2\n",
+        "ADD A C 99999999999 1 Air2\n",
+        "ADD A C 1 -1 Air2\n",
+        "REPRICE A B 2147483648 1 Air0\n",
+        "REPRICE A B -4 1 Air0\n",
+        "ADD A C 1 1\n"
+    };
+    for(const char* request : badRequests){
+        std::string answer = serve(server, request);
+        check(answer.compare(0, 6, "ERROR ") == 0 && answer.find("\n\n") == answer.size() - 2, request);
+        check(serve(server, "A C T\n") == plan, "a rejected request leaves the network unchanged");
+    }
+
+    // a line up to the limit is answered, a longer one is refused and the next line is read as usual
+    std::string longest = "A C T" + std::string(PlannerServer::MAX_LINE_LENGTH - 5, ' ');
+    check(serve(server, longest + "\n") == plan, "a line at the length limit is answered");
+    check(serve(server, longest + longest + "\nA C T\n") == "ERROR request line too long\n\n" + plan,
+          "a line past the length limit is skipped");
+
+    check(serve(server, "ADD A C 1 1 Air2\n") == "OK 2\n\n", "a valid flight is added");
+    check(serve(server, "A C T\n").find("Time: 1 Cost: 1") != std::string::npos, "the added flight is planned");
+
+    return failures == 0 ? 0 : 1;
+}